@@ -0,0 +1,109 @@
+//Times the world * view * projection chain that a renderer builds for every instance, once through
+//Matrix::operator*= and once through the batch Matrix::Multiply. Built twice by premake, as
+//YAX.Math.Benchmark (SIMD) and YAX.Math.Benchmark.Scalar (YAX_NO_SIMD), so the two can be compared.
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "SIMD.h"
+#include "YAX.Math.h"
+
+using namespace YAX;
+
+namespace
+{
+    constexpr ui32 InstanceCount = 200000;
+    constexpr ui32 Runs = 20;
+
+    //Runs fn Runs times and returns the fastest run in nanoseconds per instance
+    template <typename F>
+    double Time(F fn)
+    {
+        double best = 1e30;
+
+        for (ui32 r = 0; r < Runs; r++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto end = std::chrono::steady_clock::now();
+
+            double ns = std::chrono::duration<double, std::nano>(end - start).count() / InstanceCount;
+            best = ns < best ? ns : best;
+        }
+
+        return best;
+    }
+
+    //Sums every element so the compiler can't drop the work, and so the two builds can be checked against each other
+    float Checksum(const std::vector<Matrix>& matrices)
+    {
+        float sum = 0;
+
+        for (const Matrix& m : matrices)
+        {
+            const float* f = &m.M11;
+            for (ui32 i = 0; i < 16; i++)
+            {
+                sum += f[i];
+            }
+        }
+
+        return sum;
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> angle(-MathHelper::Pi, MathHelper::Pi);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+
+    std::vector<Matrix> world(InstanceCount, Matrix::Identity);
+    for (Matrix& w : world)
+    {
+        w = Matrix::CreateScale(1.5f) * Matrix::CreateFromYawPitchRoll(angle(rng), angle(rng), angle(rng)) *
+            Matrix::CreateTranslation(position(rng), position(rng), position(rng));
+    }
+
+    Matrix view = Matrix::CreateLookAt(Vector3(0, 50, 200), Vector3(0, 0, 0), Vector3(0, 1, 0));
+    Matrix proj = Matrix::CreatePerspectiveFieldOfView(MathHelper::PiOver4, 16.0f / 9.0f, 0.1f, 1000.0f);
+
+    std::vector<Matrix> wvp(InstanceCount, Matrix::Identity);
+
+    double operatorTime = Time([&]
+    {
+        for (ui32 i = 0; i < InstanceCount; i++)
+        {
+            Matrix m = world[i];
+            m *= view;
+            m *= proj;
+            wvp[i] = m;
+        }
+    });
+    float operatorSum = Checksum(wvp);
+
+    double multiplyTime = Time([&]
+    {
+        Matrix::Multiply(world.data(), view, wvp.data(), InstanceCount);
+        Matrix::Multiply(wvp.data(), proj, wvp.data(), InstanceCount);
+    });
+    float multiplySum = Checksum(wvp);
+
+    //SIMD.h is included directly, so the mode is right whether or not the library is built inline
+#ifdef YAX_NO_SIMD
+    const char* mode = "scalar (YAX_NO_SIMD)";
+#elif defined(YAX_AVX)
+    const char* mode = "AVX";
+#elif defined(YAX_SSE)
+    const char* mode = "SSE2";
+#else
+    const char* mode = "scalar (no SSE2 target)";
+#endif
+
+    std::printf("%s, %u instances, best of %u runs\n", mode, InstanceCount, Runs);
+    std::printf("  operator*= chain:   %6.2f ns per instance (checksum %g)\n", operatorTime, operatorSum);
+    std::printf("  Matrix::Multiply:   %6.2f ns per instance (checksum %g)\n", multiplyTime, multiplySum);
+
+    return 0;
+}
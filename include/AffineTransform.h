@@ -0,0 +1,211 @@
+#ifndef _AFFINE_TRANSFORM_H
+#define _AFFINE_TRANSFORM_H
+
+#include "Parallel.h"
+#include "Utils.h"
+
+namespace YAX
+{
+    struct Matrix;
+    struct Quaternion;
+    struct Vector3;
+
+    /**
+    * @brief A row-major 3x4 affine transformation; a Matrix whose fourth column is always (0, 0, 0, 1)
+    *
+    * The fourth column is implied rather than stored, so the transform takes 12 floats instead of 16,
+    * and concatenating two transforms takes 36 multiplies instead of 64.
+    */
+    struct AffineTransform
+    {
+        static const AffineTransform Identity;
+
+        float M11, M12, M13,
+              M21, M22, M23,
+              M31, M32, M33,
+              M41, M42, M43;
+
+        AffineTransform() = default;
+        constexpr AffineTransform(float m11, float m12, float m13,
+                                  float m21, float m22, float m23,
+                                  float m31, float m32, float m33,
+                                  float m41, float m42, float m43);
+
+        /**
+        * @brief Converts the transform to a Matrix whose fourth column is (0, 0, 0, 1)
+        */
+        constexpr Matrix ToMatrix() const;
+
+        /**
+        * @brief Creates an affine transform from a matrix, dropping its fourth column
+        *
+        * The conversion is lossless if mat is affine, i.e. its fourth column is (0, 0, 0, 1).
+        *
+        * @param mat The matrix to convert
+        * @return The affine transform
+        */
+        static constexpr AffineTransform CreateFromMatrix(const Matrix& mat);
+
+        /**
+        * @brief Converts an array of rotations, with optional scales and translations, into Scale * Rotation * Translation transforms
+        *
+        * Four quaternions are converted at a time; see Matrix::CreateFromQuaternion.
+        *
+        * @param rotations The array of rotations to convert
+        * @param scales Optional array of scale factors, one per rotation; Pass nullptr if not needed
+        * @param translations Optional array of translations, one per rotation; Pass nullptr if not needed
+        * @param dest The array to store the transforms in, e.g. a skinning palette
+        * @param count The number of transforms to create
+        */
+        static void CreateFromQuaternion(const Quaternion* rotations, const Vector3* scales, const Vector3* translations, AffineTransform* dest, ui32 count);
+
+        /**
+        * @brief Finds the inverse of an affine transform
+        *
+        * @param transform The transform to find the inverse of
+        * @return The inverted transform
+        */
+        static AffineTransform Invert(const AffineTransform& transform);
+
+        /**
+        * @brief Finds the inverse of an affine transform and reports whether it is singular
+        *
+        * @param transform The transform to find the inverse of
+        * @param result Output parameter for the inverted transform; left unchanged if transform is singular
+        * @param determinant Optional output parameter for the determinant of transform; Pass nullptr if not needed
+        * @return true if transform is invertible, false if it is singular
+        */
+        static bool Invert(const AffineTransform& transform, AffineTransform& result, float* determinant);
+
+        /**
+        * @brief Finds the inverse of a transform made only of a rotation and a translation
+        *
+        * The rotation is inverted by transposing it, so the result is wrong if transform contains any scale or shear.
+        *
+        * @param transform The rigid transform to find the inverse of
+        * @return The inverted transform
+        */
+        static AffineTransform InvertRigid(const AffineTransform& transform);
+
+        /**
+        * @brief Multiplies every transform in an array by the same transform
+        *
+        * @param source The array of left-hand transforms
+        * @param transform The right-hand transform
+        * @param dest The array to store the products in; may be the same array as source
+        * @param count The number of transforms to multiply
+        */
+        static void Multiply(const AffineTransform* source, const AffineTransform& transform, AffineTransform* dest, ui32 count);
+
+        /**
+        * @brief Transforms a point by an affine transform
+        *
+        * @param point The point to transform
+        * @param transform The transformation to apply
+        * @return The transformed point
+        */
+        static Vector3 TransformPoint(const Vector3& point, const AffineTransform& transform);
+
+        /**
+        * @brief Transforms an array of points by an affine transform
+        *
+        * @param source The array of points to transform
+        * @param transform The transformation to apply
+        * @param dest The array to store the transformed points in; may be the same array as source
+        * @param count The number of points to transform
+        */
+        static void TransformPoint(const Vector3* source, const AffineTransform& transform, Vector3* dest, ui32 count);
+
+        /**
+        * @brief Transforms an array of points by an affine transform, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The array of points to transform
+        * @param transform The transformation to apply
+        * @param dest The array to store the transformed points in; may be the same array as source
+        * @param count The number of points to transform
+        */
+        static void TransformPoint(ExecutionPolicy policy, const Vector3* source, const AffineTransform& transform, Vector3* dest, ui32 count);
+
+        /**
+        * @brief Transforms a normal vector by an affine transform without applying translation
+        *
+        * @param normal The normal to transform
+        * @param transform The transformation to apply
+        * @return The transformed normal
+        */
+        static Vector3 TransformNormal(const Vector3& normal, const AffineTransform& transform);
+
+        /**
+        * @brief Transforms an array of normals by an affine transform without applying translation
+        *
+        * @param source The array of normals to transform
+        * @param transform The transformation to apply
+        * @param dest The array to store the transformed normals in; may be the same array as source
+        * @param count The number of normals to transform
+        */
+        static void TransformNormal(const Vector3* source, const AffineTransform& transform, Vector3* dest, ui32 count);
+
+        /**
+        * @brief Transforms an array of normals by an affine transform without applying translation, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The array of normals to transform
+        * @param transform The transformation to apply
+        * @param dest The array to store the transformed normals in; may be the same array as source
+        * @param count The number of normals to transform
+        */
+        static void TransformNormal(ExecutionPolicy policy, const Vector3* source, const AffineTransform& transform, Vector3* dest, ui32 count);
+
+        AffineTransform& operator*=(const AffineTransform&);
+    };
+
+    AffineTransform operator*(AffineTransform, const AffineTransform&);
+
+    bool operator==(const AffineTransform&, const AffineTransform&);
+    bool operator!=(const AffineTransform&, const AffineTransform&);
+}
+
+//Included after the declarations above so that the headers can depend on each other
+#include "Matrix.h"
+#include "Vector3.h"
+
+namespace YAX
+{
+    constexpr AffineTransform::AffineTransform(float m11, float m12, float m13,
+                                               float m21, float m22, float m23,
+                                               float m31, float m32, float m33,
+                                               float m41, float m42, float m43)
+        : M11(m11), M12(m12), M13(m13),
+          M21(m21), M22(m22), M23(m23),
+          M31(m31), M32(m32), M33(m33),
+          M41(m41), M42(m42), M43(m43)
+    {}
+
+    constexpr Matrix AffineTransform::ToMatrix() const
+    {
+        return Matrix(M11, M12, M13, 0.0f,
+                      M21, M22, M23, 0.0f,
+                      M31, M32, M33, 0.0f,
+                      M41, M42, M43, 1.0f);
+    }
+
+    constexpr AffineTransform AffineTransform::CreateFromMatrix(const Matrix& m)
+    {
+        return AffineTransform(m.M11, m.M12, m.M13,
+                               m.M21, m.M22, m.M23,
+                               m.M31, m.M32, m.M33,
+                               m.M41, m.M42, m.M43);
+    }
+
+    constexpr AffineTransform AffineTransform::Identity = AffineTransform(1.0f, 0.0f, 0.0f,
+                                                                          0.0f, 1.0f, 0.0f,
+                                                                          0.0f, 0.0f, 1.0f,
+                                                                          0.0f, 0.0f, 0.0f);
+}
+
+#ifdef YAX_MATH_INLINE
+#include "AffineTransform.inl"
+#endif
+
+#endif
@@ -0,0 +1,257 @@
+#include <cmath>
+#include "MathHelper.h"
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "SIMD.h"
+#include "Vector3.h"
+
+namespace YAX
+{
+    static_assert(sizeof(AffineTransform) == 12 * sizeof(float), "AffineTransform must be 12 tightly packed floats");
+
+    namespace Detail
+    {
+        //Inverts the upper 3x3 of an affine transform and back-substitutes the translation
+        YAX_INLINE AffineTransform InvertAffineTransform(const AffineTransform& m, float& det)
+        {
+            AffineTransform res;
+#ifdef YAX_SSE
+            __m128 rows[4], inv[4];
+            SIMD::LoadAffine(&m.M11, rows);
+            det = _mm_cvtss_f32(SIMD::InvertAffineRows(rows[0], rows[1], rows[2], rows[3], inv));
+            SIMD::StoreAffine(&res.M11, inv);
+#else
+            //Rows of the 3x3 cofactor matrix
+            float c11 = m.M22*m.M33 - m.M23*m.M32;
+            float c12 = m.M23*m.M31 - m.M21*m.M33;
+            float c13 = m.M21*m.M32 - m.M22*m.M31;
+            float c21 = m.M32*m.M13 - m.M33*m.M12;
+            float c22 = m.M33*m.M11 - m.M31*m.M13;
+            float c23 = m.M31*m.M12 - m.M32*m.M11;
+            float c31 = m.M12*m.M23 - m.M13*m.M22;
+            float c32 = m.M13*m.M21 - m.M11*m.M23;
+            float c33 = m.M11*m.M22 - m.M12*m.M21;
+
+            det = m.M11*c11 + m.M12*c12 + m.M13*c13;
+            float inv = 1 / det;
+
+            res = AffineTransform(c11*inv, c21*inv, c31*inv,
+                                  c12*inv, c22*inv, c32*inv,
+                                  c13*inv, c23*inv, c33*inv,
+                                  -(m.M41*c11 + m.M42*c12 + m.M43*c13)*inv,
+                                  -(m.M41*c21 + m.M42*c22 + m.M43*c23)*inv,
+                                  -(m.M41*c31 + m.M42*c32 + m.M43*c33)*inv);
+#endif
+            return res;
+        }
+    }
+
+    YAX_INLINE void AffineTransform::CreateFromQuaternion(const Quaternion* rotations, const Vector3* scales, const Vector3* translations, AffineTransform* dest, ui32 count)
+    {
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 rows[4][4];
+            SIMD::QuaternionsToRows(&rotations[i].X, scales ? &scales[i].X : nullptr, translations ? &translations[i].X : nullptr, rows);
+
+            for (ui32 j = 0; j < 4; j++)
+            {
+                SIMD::StoreAffine(&dest[i + j].M11, rows[j]);
+            }
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            Matrix m = Matrix::Identity;
+            Matrix::CreateFromQuaternion(&rotations[i], scales ? &scales[i] : nullptr, translations ? &translations[i] : nullptr, &m, 1);
+            dest[i] = CreateFromMatrix(m);
+        }
+    }
+
+    YAX_INLINE AffineTransform AffineTransform::Invert(const AffineTransform& transform)
+    {
+        float det;
+        return Detail::InvertAffineTransform(transform, det);
+    }
+
+    YAX_INLINE bool AffineTransform::Invert(const AffineTransform& transform, AffineTransform& result, float* determinant)
+    {
+        float det;
+        AffineTransform inv = Detail::InvertAffineTransform(transform, det);
+
+        if (determinant != nullptr)
+            *determinant = det;
+
+        //Only the upper 3x3 contributes to the determinant, so the translation row is left out of its bound
+        float rowLengthProduct = std::sqrt(transform.M11*transform.M11 + transform.M12*transform.M12 + transform.M13*transform.M13) *
+                                 std::sqrt(transform.M21*transform.M21 + transform.M22*transform.M22 + transform.M23*transform.M23) *
+                                 std::sqrt(transform.M31*transform.M31 + transform.M32*transform.M32 + transform.M33*transform.M33);
+
+        if (Detail::IsSingular(det, rowLengthProduct))
+            return false;
+
+        result = inv;
+        return true;
+    }
+
+    YAX_INLINE AffineTransform AffineTransform::InvertRigid(const AffineTransform& m)
+    {
+#ifdef YAX_SSE
+        AffineTransform res;
+        __m128 rows[4], inv[4];
+        SIMD::LoadAffine(&m.M11, rows);
+        SIMD::InvertRigidRows(rows[0], rows[1], rows[2], rows[3], inv);
+        SIMD::StoreAffine(&res.M11, inv);
+        return res;
+#else
+        //The rotation's inverse is its transpose, and the translation is rotated back by it
+        return AffineTransform(m.M11, m.M21, m.M31,
+                               m.M12, m.M22, m.M32,
+                               m.M13, m.M23, m.M33,
+                               -(m.M41*m.M11 + m.M42*m.M12 + m.M43*m.M13),
+                               -(m.M41*m.M21 + m.M42*m.M22 + m.M43*m.M23),
+                               -(m.M41*m.M31 + m.M42*m.M32 + m.M43*m.M33));
+#endif
+    }
+
+    YAX_INLINE void AffineTransform::Multiply(const AffineTransform* source, const AffineTransform& transform, AffineTransform* dest, ui32 count)
+    {
+#ifdef YAX_SSE
+        __m128 b[4];
+        SIMD::LoadAffine(&transform.M11, b);
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            __m128 a[4], res[4];
+            SIMD::LoadAffine(&source[i].M11, a);
+            SIMD::MultiplyAffine(a, b, res);
+            SIMD::StoreAffine(&dest[i].M11, res);
+        }
+#else
+        AffineTransform b = transform;
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            dest[i] = source[i] * b;
+        }
+#endif
+    }
+
+    YAX_INLINE Vector3 AffineTransform::TransformPoint(const Vector3& p, const AffineTransform& t)
+    {
+        return Vector3
+        (
+            p.X*t.M11 + p.Y*t.M21 + p.Z*t.M31 + t.M41,
+            p.X*t.M12 + p.Y*t.M22 + p.Z*t.M32 + t.M42,
+            p.X*t.M13 + p.Y*t.M23 + p.Z*t.M33 + t.M43
+        );
+    }
+
+    YAX_INLINE void AffineTransform::TransformPoint(const Vector3* source, const AffineTransform& transform, Vector3* dest, ui32 count)
+    {
+        //Copied so the compiler can keep it in registers even though dest may alias it
+        AffineTransform t = transform;
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            dest[i] = TransformPoint(source[i], t);
+        }
+    }
+
+    YAX_INLINE void AffineTransform::TransformPoint(ExecutionPolicy policy, const Vector3* source, const AffineTransform& transform, Vector3* dest, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(2 * sizeof(Vector3)), [&](ui32 begin, ui32 end)
+        {
+            TransformPoint(source + begin, transform, dest + begin, end - begin);
+        });
+    }
+
+    YAX_INLINE Vector3 AffineTransform::TransformNormal(const Vector3& n, const AffineTransform& t)
+    {
+        return Vector3
+        (
+            n.X*t.M11 + n.Y*t.M21 + n.Z*t.M31,
+            n.X*t.M12 + n.Y*t.M22 + n.Z*t.M32,
+            n.X*t.M13 + n.Y*t.M23 + n.Z*t.M33
+        );
+    }
+
+    YAX_INLINE void AffineTransform::TransformNormal(const Vector3* source, const AffineTransform& transform, Vector3* dest, ui32 count)
+    {
+        AffineTransform t = transform;
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            dest[i] = TransformNormal(source[i], t);
+        }
+    }
+
+    YAX_INLINE void AffineTransform::TransformNormal(ExecutionPolicy policy, const Vector3* source, const AffineTransform& transform, Vector3* dest, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(2 * sizeof(Vector3)), [&](ui32 begin, ui32 end)
+        {
+            TransformNormal(source + begin, transform, dest + begin, end - begin);
+        });
+    }
+
+    YAX_INLINE AffineTransform& AffineTransform::operator*=(const AffineTransform& m)
+    {
+#ifdef YAX_SSE
+        __m128 a[4], b[4], res[4];
+        SIMD::LoadAffine(&M11, a);
+        SIMD::LoadAffine(&m.M11, b);
+        SIMD::MultiplyAffine(a, b, res);
+        SIMD::StoreAffine(&M11, res);
+#else
+        float m11 = M11*m.M11 + M12*m.M21 + M13*m.M31;
+        float m12 = M11*m.M12 + M12*m.M22 + M13*m.M32;
+        float m13 = M11*m.M13 + M12*m.M23 + M13*m.M33;
+        float m21 = M21*m.M11 + M22*m.M21 + M23*m.M31;
+        float m22 = M21*m.M12 + M22*m.M22 + M23*m.M32;
+        float m23 = M21*m.M13 + M22*m.M23 + M23*m.M33;
+        float m31 = M31*m.M11 + M32*m.M21 + M33*m.M31;
+        float m32 = M31*m.M12 + M32*m.M22 + M33*m.M32;
+        float m33 = M31*m.M13 + M32*m.M23 + M33*m.M33;
+        float m41 = M41*m.M11 + M42*m.M21 + M43*m.M31 + m.M41;
+        float m42 = M41*m.M12 + M42*m.M22 + M43*m.M32 + m.M42;
+        float m43 = M41*m.M13 + M42*m.M23 + M43*m.M33 + m.M43;
+
+        *this = AffineTransform(m11, m12, m13,
+                                m21, m22, m23,
+                                m31, m32, m33,
+                                m41, m42, m43);
+#endif
+        return *this;
+    }
+
+    YAX_INLINE AffineTransform operator*(AffineTransform lhs, const AffineTransform& rhs)
+    {
+        return lhs *= rhs;
+    }
+
+    YAX_INLINE bool operator==(const AffineTransform& lhs, const AffineTransform& rhs)
+    {
+        using MathHelper::EqualWithinEpsilon;
+
+        return EqualWithinEpsilon(lhs.M11, rhs.M11) &&
+               EqualWithinEpsilon(lhs.M12, rhs.M12) &&
+               EqualWithinEpsilon(lhs.M13, rhs.M13) &&
+               EqualWithinEpsilon(lhs.M21, rhs.M21) &&
+               EqualWithinEpsilon(lhs.M22, rhs.M22) &&
+               EqualWithinEpsilon(lhs.M23, rhs.M23) &&
+               EqualWithinEpsilon(lhs.M31, rhs.M31) &&
+               EqualWithinEpsilon(lhs.M32, rhs.M32) &&
+               EqualWithinEpsilon(lhs.M33, rhs.M33) &&
+               EqualWithinEpsilon(lhs.M41, rhs.M41) &&
+               EqualWithinEpsilon(lhs.M42, rhs.M42) &&
+               EqualWithinEpsilon(lhs.M43, rhs.M43);
+    }
+
+    YAX_INLINE bool operator!=(const AffineTransform& lhs, const AffineTransform& rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
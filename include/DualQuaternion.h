@@ -0,0 +1,128 @@
+#ifndef _DUAL_QUATERNION_H
+#define _DUAL_QUATERNION_H
+
+#include "Quaternion.h"
+#include "Utils.h"
+
+namespace YAX
+{
+    struct Matrix;
+    struct Vector3;
+
+    /**
+    * @brief A rigid transformation (rotation followed by translation) stored as a unit dual quaternion
+    *
+    * Takes 8 floats instead of a Matrix's 16, and blending dual quaternions keeps the result rigid, so skinning with
+    * them avoids the volume loss ("candy wrapper" twisting) of blending matrices.
+    */
+    struct DualQuaternion
+    {
+        static const DualQuaternion Identity;
+
+        Quaternion Real, Dual;
+
+        /**
+        * @brief Creates a dual quaternion from precalculated parts
+        *
+        * @param real The rotation part
+        * @param dual The translation part; dual = 0.5 * (translation, 0) * real
+        */
+        constexpr DualQuaternion(const Quaternion& real, const Quaternion& dual);
+
+        /**
+        * @brief Gets the rotation part of the transform
+        */
+        Quaternion GetRotation() const;
+
+        /**
+        * @brief Gets the translation part of the transform
+        */
+        Vector3 GetTranslation() const;
+
+        /**
+        * @brief Normalizes the dual quaternion, so it represents a rigid transform again after blending or accumulated error
+        */
+        void Normalize();
+
+        /**
+        * @brief Converts the transform to a rotation and translation matrix
+        */
+        Matrix ToMatrix() const;
+
+        /**
+        * @brief Combines two transforms into a single transform
+        *
+        * @param first The first transform
+        * @param second The second transform
+        * @return The dual quaternion representing the first transform followed by the second transform
+        */
+        static DualQuaternion Concatenate(const DualQuaternion& first, const DualQuaternion& second);
+
+        /**
+        * @brief Creates a rigid transform from a rotation matrix with a translation in its fourth row
+        *
+        * @param mat The matrix to convert; must not contain scale or shear
+        * @return The dual quaternion representing the same transform
+        */
+        static DualQuaternion CreateFromMatrix(const Matrix& mat);
+
+        /**
+        * @brief Creates a transform that rotates and then translates
+        *
+        * @param rotation The rotation; must be normalized
+        * @param translation The translation
+        * @return The dual quaternion representing the transform
+        */
+        static DualQuaternion CreateFromRotationTranslation(const Quaternion& rotation, const Vector3& translation);
+
+        /**
+        * @brief Finds the normal of a given dual quaternion
+        *
+        * @param dq The dual quaternion to normalize
+        * @return The normalized dual quaternion
+        */
+        static DualQuaternion Normalize(DualQuaternion dq);
+
+        /**
+        * @brief Transforms a point by a dual quaternion
+        *
+        * @param point The point to transform
+        * @param dq The transformation to apply; must be normalized
+        * @return The transformed point
+        */
+        static Vector3 TransformPoint(const Vector3& point, const DualQuaternion& dq);
+
+        /**
+        * @brief Blends palette entries for each vertex with up to four weighted influences, i.e. dual quaternion skinning
+        *
+        * Each influence is flipped onto the same hemisphere as the vertex's first influence before it's weighted, so
+        * blending never takes the long way around, and each result is normalized. Unused influences should have a weight of 0.
+        *
+        * @param palette The array of bone transforms; each must be normalized
+        * @param indices Four palette indices per vertex
+        * @param weights Four weights per vertex, usually summing to 1
+        * @param dest The array to store each vertex's blended transform in
+        * @param count The number of vertices
+        */
+        static void Blend(const DualQuaternion* palette, const ui16* indices, const float* weights, DualQuaternion* dest, ui32 count);
+
+        DualQuaternion& operator*=(const DualQuaternion&);
+    };
+
+    DualQuaternion operator*(DualQuaternion, const DualQuaternion&);
+
+    bool operator==(const DualQuaternion&, const DualQuaternion&);
+    bool operator!=(const DualQuaternion&, const DualQuaternion&);
+
+    constexpr DualQuaternion::DualQuaternion(const Quaternion& real, const Quaternion& dual)
+        : Real(real), Dual(dual)
+    {}
+
+    constexpr DualQuaternion DualQuaternion::Identity = DualQuaternion(Quaternion::Identity, Quaternion(0.0f, 0.0f, 0.0f, 0.0f));
+}
+
+#ifdef YAX_MATH_INLINE
+#include "DualQuaternion.inl"
+#endif
+
+#endif
@@ -0,0 +1,144 @@
+#include "Matrix.h"
+#include "SIMD.h"
+#include "Vector3.h"
+
+namespace YAX
+{
+    static_assert(sizeof(DualQuaternion) == 8 * sizeof(float), "DualQuaternion must be 8 tightly packed floats");
+
+    YAX_INLINE Quaternion DualQuaternion::GetRotation() const
+    {
+        return Real;
+    }
+
+    YAX_INLINE Vector3 DualQuaternion::GetTranslation() const
+    {
+        //translation = 2 * dual * conjugate(real); its real part is 0 for a normalized dual quaternion
+        Quaternion t = Dual * Quaternion::Conjugate(Real);
+        return Vector3(2 * t.X, 2 * t.Y, 2 * t.Z);
+    }
+
+    YAX_INLINE void DualQuaternion::Normalize()
+    {
+        float len = Real.Length();
+        Real /= len;
+        Dual /= len;
+
+        //Removes the part of Dual that isn't orthogonal to Real, which isn't a rigid transform
+        Dual -= Real * Quaternion::Dot(Real, Dual);
+    }
+
+    YAX_INLINE Matrix DualQuaternion::ToMatrix() const
+    {
+        Matrix m = Matrix::CreateFromQuaternion(Real);
+        Vector3 t = GetTranslation();
+
+        m.M41 = t.X;
+        m.M42 = t.Y;
+        m.M43 = t.Z;
+        return m;
+    }
+
+    YAX_INLINE DualQuaternion DualQuaternion::Concatenate(const DualQuaternion& first, const DualQuaternion& second)
+    {
+        return second*first;
+    }
+
+    YAX_INLINE DualQuaternion DualQuaternion::CreateFromMatrix(const Matrix& mat)
+    {
+        return CreateFromRotationTranslation(Quaternion::CreateFromRotationMatrix(mat), Vector3(mat.M41, mat.M42, mat.M43));
+    }
+
+    YAX_INLINE DualQuaternion DualQuaternion::CreateFromRotationTranslation(const Quaternion& rotation, const Vector3& translation)
+    {
+        return DualQuaternion(rotation, Quaternion(translation * 0.5f, 0.0f) * rotation);
+    }
+
+    YAX_INLINE DualQuaternion DualQuaternion::Normalize(DualQuaternion dq)
+    {
+        dq.Normalize();
+        return dq;
+    }
+
+    YAX_INLINE Vector3 DualQuaternion::TransformPoint(const Vector3& point, const DualQuaternion& dq)
+    {
+        return Vector3::Transform(point, dq.Real) + dq.GetTranslation();
+    }
+
+    YAX_INLINE void DualQuaternion::Blend(const DualQuaternion* palette, const ui16* indices, const float* weights, DualQuaternion* dest, ui32 count)
+    {
+        for (ui32 i = 0; i < count; i++)
+        {
+            const ui16* index = indices + 4 * i;
+            const float* weight = weights + 4 * i;
+
+#ifdef YAX_SSE
+            //Each part lives in one register; the operations and their order match the scalar path below
+            __m128 pivot = _mm_loadu_ps(&palette[index[0]].Real.X);
+            __m128 real = _mm_mul_ps(pivot, _mm_set1_ps(weight[0]));
+            __m128 dual = _mm_mul_ps(_mm_loadu_ps(&palette[index[0]].Dual.X), _mm_set1_ps(weight[0]));
+
+            for (ui32 j = 1; j < 4; j++)
+            {
+                const DualQuaternion& dq = palette[index[j]];
+                __m128 r = _mm_loadu_ps(&dq.Real.X);
+
+                //q and -q are the same rotation, so flip the weight of influences on the other hemisphere from the first
+                __m128 w = _mm_set1_ps(weight[j]);
+                w = _mm_xor_ps(w, _mm_and_ps(_mm_cmplt_ps(SIMD::Dot4(r, pivot), _mm_setzero_ps()), _mm_set1_ps(-0.0f)));
+
+                real = _mm_add_ps(real, _mm_mul_ps(r, w));
+                dual = _mm_add_ps(dual, _mm_mul_ps(_mm_loadu_ps(&dq.Dual.X), w));
+            }
+
+            __m128 len = _mm_sqrt_ps(SIMD::Dot4(real, real));
+            real = _mm_div_ps(real, len);
+            dual = _mm_div_ps(dual, len);
+            dual = _mm_sub_ps(dual, _mm_mul_ps(real, SIMD::Dot4(real, dual)));
+
+            _mm_storeu_ps(&dest[i].Real.X, real);
+            _mm_storeu_ps(&dest[i].Dual.X, dual);
+#else
+            const Quaternion& pivot = palette[index[0]].Real;
+            DualQuaternion result(pivot * weight[0], palette[index[0]].Dual * weight[0]);
+
+            for (ui32 j = 1; j < 4; j++)
+            {
+                const DualQuaternion& dq = palette[index[j]];
+
+                //q and -q are the same rotation, so flip the weight of influences on the other hemisphere from the first
+                float w = Quaternion::Dot(dq.Real, pivot) < 0.0f ? -weight[j] : weight[j];
+
+                result.Real += dq.Real * w;
+                result.Dual += dq.Dual * w;
+            }
+
+            result.Normalize();
+            dest[i] = result;
+#endif
+        }
+    }
+
+    YAX_INLINE DualQuaternion& DualQuaternion::operator*=(const DualQuaternion& dq)
+    {
+        Dual = Real*dq.Dual + Dual*dq.Real;
+        Real *= dq.Real;
+        return *this;
+    }
+
+    YAX_INLINE DualQuaternion operator*(DualQuaternion lhs, const DualQuaternion& rhs)
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE bool operator==(const DualQuaternion& lhs, const DualQuaternion& rhs)
+    {
+        return lhs.Real == rhs.Real && lhs.Dual == rhs.Dual;
+    }
+
+    YAX_INLINE bool operator!=(const DualQuaternion& lhs, const DualQuaternion& rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
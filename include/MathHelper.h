@@ -1,6 +1,8 @@
 #ifndef _MATH_HELPER_H
 #define _MATH_HELPER_H
 
+#include "Utils.h"
+
 namespace YAX
 {
     namespace MathHelper
@@ -8,13 +10,13 @@ namespace YAX
         //Note that this is not const. The user may change this to suit their FP-comparison needs.
         extern float Epsilon;
         
-        extern const float E;
-        extern const float Log10E;
-        extern const float Log2E;
-        extern const float Pi;
-        extern const float PiOver2;
-        extern const float PiOver4;
-        extern const float TwoPi;
+        constexpr float E = 2.71828182845904523536f;
+        constexpr float Log10E = 0.434294481903251827651f;
+        constexpr float Log2E = 1.44269504088896340736f;
+        constexpr float Pi = 3.14159265358979323846f;
+        constexpr float PiOver2 = 1.57079632679489661923f;
+        constexpr float PiOver4 = 0.785398163397448309616f;
+        constexpr float TwoPi = 6.28318530717958647693f;
 
         /**
         * @brief Calculates a coordinate of a point defined by a triangle and two barycentric coordinates.
@@ -23,7 +25,7 @@ namespace YAX
         * @param b2, b3 The barycentric coordinates
         * @return The interpolated coordinate on the same axis as p1, p2, and p3										   
         */
-        float Barycentric(float p1, float p2, float p3, float b2, float b3);
+        constexpr float Barycentric(float p1, float p2, float p3, float b2, float b3);
         
         /**
         * @brief Interpolates between given positions using Catmull-Rom interpolation
@@ -32,7 +34,7 @@ namespace YAX
         * @param t Interpolation factor
         * @return The interpolated coordinate on the same axis as p1, p2, p3, and p4
         */
-        float CatmullRom(float p1, float p2, float p3, float p4, float t);
+        constexpr float CatmullRom(float p1, float p2, float p3, float p4, float t);
         
         /**
         * @brief Clamps a given value to a given range
@@ -42,7 +44,7 @@ namespace YAX
         * @param max Upper bound
         * @return The clamped value
         */
-        float Clamp(float val, float min, float max);
+        constexpr float Clamp(float val, float min, float max);
 
         /**
         * @brief Finds the absolute distance between two values
@@ -80,7 +82,7 @@ namespace YAX
         * @param t Interpolation factor
         * @return The interpolated value between val1 and val2
         */
-        float Lerp(float val1, float val2, float t);
+        constexpr float Lerp(float val1, float val2, float t);
         
         /**
         * @brief Finds the maximum of two given values
@@ -89,7 +91,7 @@ namespace YAX
         * @param val2 The second value
         * @return The largest of the two values
         */
-        float Max(float val1, float val2);
+        constexpr float Max(float val1, float val2);
 
         /**
         * @brief Finds the minimum of two given values
@@ -98,7 +100,7 @@ namespace YAX
         * @param val2 The second value
         * @return the lowest of the two values
         */
-        float Min(float val1, float val2);
+        constexpr float Min(float val1, float val2);
 
         /**
         * @brief Performs a smoothstep interpolation between two given values
@@ -108,7 +110,7 @@ namespace YAX
         * @param t Interpolation factor
         * @return The interpolated value between val1 and val2
         */
-        float SmoothStep(float val1, float val2, float t);
+        constexpr float SmoothStep(float val1, float val2, float t);
 
         /**
         * @brief Extracts the sign of a provided number
@@ -116,7 +118,7 @@ namespace YAX
         * @param val The value to extract the sign from
         * @return -1 if val is negative, 1 if positive, 0 if 0
         */
-        int Sign(float v);
+        constexpr int Sign(float v);
 
         /**
         * @brief Converts a given value to degrees
@@ -124,7 +126,7 @@ namespace YAX
         * @param val The value in radians to convert to degrees
         * @return The given value in degrees
         */
-        float ToDegrees(float val);
+        constexpr float ToDegrees(float val);
 
         /**
         * @brief Converts a given value to radians
@@ -132,7 +134,7 @@ namespace YAX
         * @param val The value in degrees to convert to radians
         * @return The given value in radians
         */
-        float ToRadians(float val);
+        constexpr float ToRadians(float val);
 
         /**
         * @brief Wraps an angle in radians from [0, 2pi] to [0, +-pi]
@@ -142,6 +144,79 @@ namespace YAX
         */
         float WrapAngle(float val);
     };
+
+    namespace Detail
+    {
+        //Whether a matrix is too close to singular to invert. Hadamard's inequality bounds |det| by the product of the
+        //row lengths, so the test is relative to that bound and doesn't reject matrices that are merely uniformly small.
+        bool IsSingular(float det, float rowLengthProduct);
+    }
+
+    constexpr float MathHelper::Barycentric(float vert1, float vert2, float vert3, float weight2, float weight3)
+    {
+        weight2 = Clamp(weight2, 0, 1);
+        weight3 = Clamp(weight3, 0, 1);
+
+        return ((1 - weight2 - weight3) * vert1 + weight2 * vert2 + weight3 * vert3);
+    }
+
+    constexpr float MathHelper::CatmullRom(float p1, float p2, float p3, float p4, float t)
+    {
+        //using simplified basis matrix from http://www.cs.cmu.edu/~462/projects/assn2/assn2/catmullRom.pdf
+        float threeHalves = 1.5f*t, oneHalf = t / 2.0f;
+        
+        float c1 = (-0.5f + t*(1 - oneHalf))*p1;
+        float c2 = (1 + (t*t*(-2.5f + threeHalves)))*p2;
+        float c3 = (0.5f + t*(2 - threeHalves))*p3;
+        float c4 = (-0.5f + oneHalf)*t*p4;
+
+        return c2 + t*(c1 + c3 + c4);
+    }
+
+    constexpr float MathHelper::Clamp(float val, float min, float max)
+    {
+        return Max(min, Min(max, val));
+    }
+
+    constexpr float MathHelper::Lerp(float val1, float val2, float t)
+    {
+        return val1 + (val2 - val1) * t;
+    }
+
+    constexpr float MathHelper::Max(float val1, float val2)
+    {
+        return (val1 > val2 ? val1 : val2);
+    }
+
+    constexpr float MathHelper::Min(float val1, float val2)
+    {
+        return (val1 < val2 ? val1 : val2);
+    }
+
+    constexpr float MathHelper::SmoothStep(float val1, float val2, float t)
+    {
+        t = Clamp(t, 0, 1);
+        return Lerp(val1, val2, t*t*(3 - 2 * t));
+    }
+
+    constexpr int MathHelper::Sign(float v)
+    {
+        return (v > 0 ? 1 : (v == 0 ? 0 : -1));
+    }
+
+    constexpr float MathHelper::ToDegrees(float val)
+    {
+        return val*180.0f / Pi;
+    }
+
+    constexpr float MathHelper::ToRadians(float val)
+    {
+        return val*Pi / 180.0f;
+    }
 }
 
-#endif 
\ No newline at end of file
+#ifdef YAX_MATH_INLINE
+#include "MathHelper.inl"
+#endif
+
+#endif
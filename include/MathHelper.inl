@@ -0,0 +1,37 @@
+#include <cmath>
+#include <limits>
+
+namespace YAX
+{
+    YAX_INLINE float MathHelper::Epsilon = 0.0000001f;
+
+    YAX_INLINE float MathHelper::Distance(float val1, float val2)
+    {
+        return std::abs(val1 - val2);
+    }
+
+    YAX_INLINE bool MathHelper::EqualWithinEpsilon(float val1, float val2)
+    {
+        return std::fabs(val1 - val2) < MathHelper::Epsilon;
+    }
+
+    YAX_INLINE bool Detail::IsSingular(float det, float rowLengthProduct)
+    {
+        return std::fabs(det) <= std::numeric_limits<float>::epsilon() * rowLengthProduct;
+    }
+
+    YAX_INLINE float MathHelper::Hermite(float val1, float m1, float val2, float m2, float t)
+    {
+        float c1 = std::pow(1 - t, 2)*((1 + 2*t)*val1 + t*m1);
+        float c2 = t*t*((3 - 2*t)*val2 + (t - 1)*m2);
+
+        return c1 + c2;
+    }
+
+    YAX_INLINE float MathHelper::WrapAngle(float val)
+    {
+        val = std::fmod(val, TwoPi);;
+        return (val > Pi ? -(TwoPi - val) : val);
+    }
+
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #ifndef _MATRIX_H
 #define _MATRIX_H
 
+#include "Utils.h"
+
 namespace YAX
 {
     struct Vector3;
@@ -24,7 +26,7 @@ namespace YAX
         /** @brief The Catmull-Rom interpolation matrix */
         static const Matrix CatmullRomMat;
 
-        Matrix(
+        constexpr Matrix(
             float M11, float M12, float M13, float M14,
             float M21, float M22, float M23, float M24,
             float M31, float M32, float M33, float M34,
@@ -107,6 +109,20 @@ namespace YAX
         * @return The rotation matrix
         */
         static Matrix CreateFromQuaternion(const Quaternion& q);
+
+        /**
+        * @brief Converts an array of rotations, with optional scales and translations, into Scale * Rotation * Translation matrices
+        *
+        * Four quaternions are converted at a time, which is much cheaper than calling CreateFromQuaternion
+        * and multiplying by CreateScale and CreateTranslation for each one, e.g. for every bone of a skeleton.
+        *
+        * @param rotations The array of rotations to convert
+        * @param scales Optional array of scale factors, one per rotation; Pass nullptr if not needed
+        * @param translations Optional array of translations, one per rotation; Pass nullptr if not needed
+        * @param dest The array to store the matrices in
+        * @param count The number of matrices to create
+        */
+        static void CreateFromQuaternion(const Quaternion* rotations, const Vector3* scales, const Vector3* translations, Matrix* dest, ui32 count);
         
         /**
         * @brief Creates a rotation matrix from yaw (Y), pitch (X), and roll (Z) angles
@@ -137,7 +153,7 @@ namespace YAX
         * @param zFar The maximum z-value of the view box
         * @return The orthographic projection matrix
         */
-        static Matrix CreateOrthographic(float width, float height, float zNear, float zFar);
+        static constexpr Matrix CreateOrthographic(float width, float height, float zNear, float zFar);
         
         /**
         * @brief Creates an off-center orthographic projection matrix
@@ -150,7 +166,7 @@ namespace YAX
         * @param zFar The maximum z-value of the view box
         * @return The off-center orthographic projection matrix
         */
-        static Matrix CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNear, float zFar);
+        static constexpr Matrix CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNear, float zFar);
         
         /**
         * @brief Creates a centered perspective projection matrix
@@ -226,7 +242,7 @@ namespace YAX
         * @param scale The scale factor
         * @return The uniform scaling matrix
         */
-        static Matrix CreateScale(float scale);
+        static constexpr Matrix CreateScale(float scale);
 
         /**
         * @brief Creates a non-uniform scaling matrix
@@ -236,7 +252,7 @@ namespace YAX
         * @param scaleZ The scale factor for the z-axis
         * @return The non-uniform scaling matrix
         */
-        static Matrix CreateScale(float scaleX, float scaleY, float scaleZ);
+        static constexpr Matrix CreateScale(float scaleX, float scaleY, float scaleZ);
         
         /**
         * @brief Creates a scaling matrix from a vector of scale factors
@@ -244,7 +260,7 @@ namespace YAX
         * @param scaleVec Vector of scale factors
         * @return The scaling matrix
         */
-        static Matrix CreateScale(const Vector3& scaleVec);
+        static constexpr Matrix CreateScale(const Vector3& scaleVec);
 
         /**
         * @brief Creates a matrix that projects onto the specified plane
@@ -264,7 +280,7 @@ namespace YAX
         * @param zT Translation along the z-axis
         * @return The translation matrix
         */
-        static Matrix CreateTranslation(float xT, float yT, float zT);
+        static constexpr Matrix CreateTranslation(float xT, float yT, float zT);
         
         /**
         * @brief Creates a translation matrix from a Vector of distances
@@ -272,7 +288,7 @@ namespace YAX
         * @param vec The Vector of translation distances
         * @return The translation matrix
         */
-        static Matrix CreateTranslation(const Vector3& vec);
+        static constexpr Matrix CreateTranslation(const Vector3& vec);
 
         /**
         * @brief Creates a world matrix that projects a point into the world's coordinate system
@@ -311,6 +327,98 @@ namespace YAX
         */
         static Matrix Invert(const Matrix& mat);
 
+        /**
+        * @brief Finds the inverse of a matrix and reports whether it is singular
+        *
+        * mat counts as singular when its determinant is negligible next to the product of its row lengths, so
+        * matrices with a tiny but uniform scale still invert.
+        *
+        * @param mat The matrix to find the inverse of
+        * @param result Output parameter for the inverted matrix; left unchanged if mat is singular
+        * @param determinant Optional output parameter for the determinant of mat; Pass nullptr if not needed
+        * @return true if mat is invertible, false if it is singular
+        */
+        static bool Invert(const Matrix& mat, Matrix& result, float* determinant);
+
+        /**
+        * @brief Finds the inverse, determinant and cofactor matrix of a matrix from one shared set of minors
+        *
+        * The cofactor matrix is the transposed adjugate, i.e. the inverse transpose scaled by the determinant.
+        * Its upper 3x3 transforms normals correctly even when mat contains non-uniform scale, without needing
+        * mat to be invertible; renormalize afterwards, and flip the result if the determinant is negative.
+        *
+        * @param mat The matrix to find the inverse of
+        * @param result Output parameter for the inverted matrix; left unchanged if mat is singular
+        * @param determinant Optional output parameter for the determinant of mat; Pass nullptr if not needed
+        * @param cofactor Optional output parameter for the cofactor matrix of mat, which is written even if mat is singular; Pass nullptr if not needed
+        * @return true if mat is invertible, false if it is singular
+        */
+        static bool Invert(const Matrix& mat, Matrix& result, float* determinant, Matrix* cofactor);
+
+        /**
+        * @brief Inverts every matrix in an array
+        *
+        * @param source The array of matrices to invert
+        * @param dest The array to store the inverses in; may be the same array as source. Entries whose matrix is singular are left unchanged
+        * @param determinants Optional array to store the determinants in; Pass nullptr if not needed
+        * @param cofactors Optional array to store the cofactor matrices in; Pass nullptr if not needed
+        * @param count The number of matrices to invert
+        * @return true if every matrix was invertible, false if any of them was singular
+        */
+        static bool Invert(const Matrix* source, Matrix* dest, float* determinants, Matrix* cofactors, ui32 count);
+
+        /**
+        * @brief Finds the inverse of an affine matrix, whose fourth column is (0, 0, 0, 1)
+        *
+        * Only the upper 3x3 is inverted; the translation is then back-substituted.
+        *
+        * @param mat The affine matrix to find the inverse of
+        * @return The inverted matrix
+        */
+        static Matrix InvertAffine(const Matrix& mat);
+
+        /**
+        * @brief Finds the inverse of an affine matrix and reports whether it is singular
+        *
+        * @param mat The affine matrix to find the inverse of
+        * @param result Output parameter for the inverted matrix; left unchanged if mat is singular
+        * @param determinant Optional output parameter for the determinant of mat; Pass nullptr if not needed
+        * @return true if mat is invertible, false if it is singular
+        */
+        static bool InvertAffine(const Matrix& mat, Matrix& result, float* determinant);
+
+        /**
+        * @brief Finds the inverse of a matrix made only of a rotation and a translation
+        *
+        * The rotation is inverted by transposing it, so the result is wrong if mat contains any scale or shear.
+        *
+        * @param mat The rigid transformation matrix to find the inverse of
+        * @return The inverted matrix
+        */
+        static Matrix InvertRigid(const Matrix& mat);
+
+        /**
+        * @brief Multiplies every matrix in an array by the same matrix
+        *
+        * The right-hand matrix is only loaded once, so this is much cheaper than calling operator* in a loop.
+        *
+        * @param source The array of left-hand matrices
+        * @param mat The right-hand matrix
+        * @param dest The array to store the products in; may be the same array as source
+        * @param count The number of matrices to multiply
+        */
+        static void Multiply(const Matrix* source, const Matrix& mat, Matrix* dest, ui32 count);
+
+        /**
+        * @brief Multiplies two arrays of matrices element by element
+        *
+        * @param source1 The array of left-hand matrices
+        * @param source2 The array of right-hand matrices
+        * @param dest The array to store the products in; may be the same array as either source
+        * @param count The number of matrices to multiply
+        */
+        static void Multiply(const Matrix* source1, const Matrix* source2, Matrix* dest, ui32 count);
+
         /**
         * @brief Performs a component-wise linear interpolation between two matrices
         *
@@ -318,7 +426,7 @@ namespace YAX
         * @param to The end (t = 1) matrix
         * @param t The interpolation weight
         */
-        static Matrix Lerp(const Matrix& from, const Matrix& to, float t);
+        static constexpr Matrix Lerp(const Matrix& from, const Matrix& to, float t);
         
         /**
         * Rotates the coordinate system represented by a matrix by a quaternion
@@ -335,7 +443,22 @@ namespace YAX
         * @param mat The matrix to transpose
         * @return The transposed matrix
         */
-        static Matrix Transpose(const Matrix& mat);
+        static constexpr Matrix Transpose(const Matrix& mat);
+
+        /**
+        * @brief Transposes an array of matrices into a buffer, e.g. to pack them column-major for upload
+        *
+        * When dest and destStride are 16-byte aligned, the matrices are written with non-temporal stores
+        * that bypass the cache, so packing a large buffer is a single bandwidth-bound pass.
+        *
+        * @param source The array of matrices to transpose
+        * @param dest The buffer to write the transposed matrices to
+        * @param destStride The distance in bytes between consecutive matrices in dest
+        * @param count The number of matrices to transpose
+        * @param truncate If true, only the first three rows of each transposed matrix (12 floats) are written,
+        *                 dropping the (0, 0, 0, 1) fourth column of an affine matrix
+        */
+        static void TransposeInto(const Matrix* source, float* dest, ui32 destStride, ui32 count, bool truncate);
 
         Matrix& operator+=(const Matrix&);
         Matrix& operator-=(const Matrix&);
@@ -358,5 +481,115 @@ namespace YAX
     bool operator!=(const Matrix&, const Matrix&);
 }
 
+//Included after the declarations above so that the headers can depend on each other
+#include "MathHelper.h"
+#include "Vector3.h"
 
-#endif
\ No newline at end of file
+namespace YAX
+{
+    constexpr Matrix::Matrix(
+        float m11, float m12, float m13, float m14,
+        float m21, float m22, float m23, float m24,
+        float m31, float m32, float m33, float m34,
+        float m41, float m42, float m43, float m44
+    ) : M11(m11), M12(m12), M13(m13), M14(m14),
+        M21(m21), M22(m22), M23(m23), M24(m24),
+        M31(m31), M32(m32), M33(m33), M34(m34),
+        M41(m41), M42(m42), M43(m43), M44(m44)
+    {}
+
+    constexpr Matrix Matrix::Identity = Matrix(1, 0, 0, 0,
+                                               0, 1, 0, 0,
+                                               0, 0, 1, 0,
+                                               0, 0, 0, 1);
+
+    //Basis matrix for [t^3 t^2 t 1] * CatmullRomMat * [p1 p2 p3 p4]
+    constexpr Matrix Matrix::CatmullRomMat = Matrix(-0.5f,  1.5f, -1.5f,  0.5f,
+                                                     1.0f, -2.5f,  2.0f, -0.5f,
+                                                    -0.5f,     0,  0.5f,     0,
+                                                        0,  1.0f,     0,     0);
+
+    constexpr Matrix Matrix::CreateOrthographic(float w, float h, float zN, float zF)
+    {
+        return Matrix(2.0f/w,	   0,            0, 0,
+                           0, 2.0f/h,            0, 0,
+                           0,      0, 1.0f/(zN-zF), 0,
+                           0,      0,   zN/(zN-zF), 1.0f);
+    }
+
+    constexpr Matrix Matrix::CreateOrthographicOffCenter(float l, float r, float b, float t, float zN, float zF)
+    {
+        return Matrix( 2.0f/(r-l),			 0,            0, 0,
+                                0,  2.0f/(t-b),            0, 0,
+                                0,			 0, 1.0f/(zN-zF), 0,
+                      (l+r)/(l-r), (t+b)/(b-t),	  zN/(zN-zF), 1.0f);
+    }
+
+    constexpr Matrix Matrix::CreateScale(float scale)
+    {
+        return Matrix(scale,	 0,		0, 0,
+                          0, scale,		0, 0,
+                          0,	 0, scale, 0,
+                          0,	 0,		0, 1.0f);
+    }
+
+    constexpr Matrix Matrix::CreateScale(float scaleX, float scaleY, float scaleZ)
+    {
+        return Matrix(scaleX,	   0,      0, 0,
+                           0, scaleY,	   0, 0,
+                           0,	   0, scaleZ, 0,
+                           0,	   0,	   0, 1.0f);
+    }
+
+    constexpr Matrix Matrix::CreateScale(const Vector3& scaleVec)
+    {
+        return CreateScale(scaleVec.X, scaleVec.Y, scaleVec.Z);
+    }
+
+    constexpr Matrix Matrix::CreateTranslation(float xT, float yT, float zT)
+    {
+        return Matrix(1.0f,    0,    0, 0,
+                         0, 1.0f,    0, 0,
+                         0,    0, 1.0f, 0,
+                        xT,    yT,  zT, 1.0f);
+    }
+
+    constexpr Matrix Matrix::CreateTranslation(const Vector3& vec)
+    {
+        return CreateTranslation(vec.X, vec.Y, vec.Z);
+    }
+
+    constexpr Matrix Matrix::Lerp(const Matrix& from, const Matrix& to, float t)
+    {
+        return Matrix(MathHelper::Lerp(from.M11, to.M11, t),
+                      MathHelper::Lerp(from.M12, to.M12, t),
+                      MathHelper::Lerp(from.M13, to.M13, t),
+                      MathHelper::Lerp(from.M14, to.M14, t),
+                      MathHelper::Lerp(from.M21, to.M21, t),
+                      MathHelper::Lerp(from.M22, to.M22, t),
+                      MathHelper::Lerp(from.M23, to.M23, t),
+                      MathHelper::Lerp(from.M24, to.M24, t),
+                      MathHelper::Lerp(from.M31, to.M31, t),
+                      MathHelper::Lerp(from.M32, to.M32, t),
+                      MathHelper::Lerp(from.M33, to.M33, t),
+                      MathHelper::Lerp(from.M34, to.M34, t),
+                      MathHelper::Lerp(from.M41, to.M41, t),
+                      MathHelper::Lerp(from.M42, to.M42, t),
+                      MathHelper::Lerp(from.M43, to.M43, t),
+                      MathHelper::Lerp(from.M44, to.M44, t));
+    }
+
+    constexpr Matrix Matrix::Transpose(const Matrix& m)
+    {
+        return Matrix(m.M11, m.M21, m.M31, m.M41,
+                      m.M12, m.M22, m.M32, m.M42,
+                      m.M13, m.M23, m.M33, m.M43,
+                      m.M14, m.M24, m.M34, m.M44);
+    }
+}
+
+#ifdef YAX_MATH_INLINE
+#include "Matrix.inl"
+#endif
+
+#endif
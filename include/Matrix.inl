@@ -0,0 +1,920 @@
+#include <cmath>
+#include <stdexcept>
+#include "MathHelper.h"
+#include "Quaternion.h"
+#include "SIMD.h"
+#include "Vector3.h"
+
+#ifdef YAX_GEOMETRY
+#include "Plane.h"
+#endif
+
+namespace YAX
+{
+    static_assert(sizeof(Matrix) == 16 * sizeof(float), "Matrix must be 16 tightly packed floats");
+
+#ifndef YAX_SSE
+    namespace Detail
+    {
+        //The 2x2 minors of the top two and bottom two rows, shared by Adjugate and Determinant
+        struct Minors
+        {
+            float s0, s1, s2, s3, s4, s5;
+            float c0, c1, c2, c3, c4, c5;
+
+            explicit Minors(const Matrix& m)
+                : s0(m.M11*m.M22 - m.M12*m.M21),
+                  s1(m.M11*m.M23 - m.M13*m.M21),
+                  s2(m.M11*m.M24 - m.M14*m.M21),
+                  s3(m.M12*m.M23 - m.M13*m.M22),
+                  s4(m.M12*m.M24 - m.M14*m.M22),
+                  s5(m.M13*m.M24 - m.M14*m.M23),
+                  c0(m.M31*m.M42 - m.M32*m.M41),
+                  c1(m.M31*m.M43 - m.M33*m.M41),
+                  c2(m.M31*m.M44 - m.M34*m.M41),
+                  c3(m.M32*m.M43 - m.M33*m.M42),
+                  c4(m.M32*m.M44 - m.M34*m.M42),
+                  c5(m.M33*m.M44 - m.M34*m.M43)
+            {}
+
+            float Determinant() const
+            {
+                return s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+            }
+        };
+    }
+#endif
+
+    YAX_INLINE Vector3 Matrix::Backward() const
+    {
+        return Vector3(M31, M32, M33);
+    }
+
+    YAX_INLINE void Matrix::Backward(const Vector3& source)
+    {
+        M31 = source.X;
+        M32 = source.Y;
+        M33 = source.Z;
+    }
+
+    YAX_INLINE Vector3 Matrix::Down() const
+    {
+        return Vector3(-M21, -M22, -M23);
+    }
+
+    YAX_INLINE void Matrix::Down(const Vector3& source)
+    {
+        M21 = source.X;
+        M22 = source.Y;
+        M23 = source.Z;
+    }
+
+    YAX_INLINE Vector3 Matrix::Forward() const
+    {
+        return -Backward();
+    }
+
+    YAX_INLINE void Matrix::Forward(const Vector3& source)
+    {
+        Backward(source);
+    }
+
+    YAX_INLINE Vector3 Matrix::Left() const
+    {
+        return Vector3(-M11, -M12, -M13);
+    }
+
+    YAX_INLINE void Matrix::Left(const Vector3& source)
+    {
+        M11 = source.X;
+        M12 = source.Y; 
+        M13 = source.Z;
+    }
+
+    YAX_INLINE Vector3	Matrix::Right() const
+    {
+        return -Left();
+    }
+
+    YAX_INLINE void Matrix::Right(const Vector3& source)
+    {
+        Left(source);
+    }
+
+    YAX_INLINE Vector3 Matrix::Translation() const
+    {
+        return Vector3(M41, M42, M43);
+    }
+
+    YAX_INLINE void Matrix::Translation(const Vector3& source)
+    {
+        M41 = source.X;
+        M42 = source.Y;
+        M43 = source.Z;
+    }
+
+    YAX_INLINE Vector3 Matrix::Up() const
+    {
+        return -Down();
+    }
+
+    YAX_INLINE void Matrix::Up(const Vector3& source)
+    {
+        Down(source);
+    }
+
+    YAX_INLINE bool Matrix::Decompose(Vector3& s, Quaternion& r, Vector3& t) const
+    {
+        using MathHelper::EqualWithinEpsilon;
+
+        float scaleX = std::sqrt(M11*M11 + M12*M12 + M13*M13);
+        float scaleY = std::sqrt(M21*M21 + M22*M22 + M23*M23);
+        float scaleZ = std::sqrt(M31*M31 + M32*M32 + M33*M33);
+
+        if (EqualWithinEpsilon(scaleX, 0) || EqualWithinEpsilon(scaleY, 0) || EqualWithinEpsilon(scaleZ, 0))
+        {
+            r = Quaternion::Identity;
+            return false;
+        }
+        
+        float invX = 1 / scaleX;
+        float invY = 1 / scaleY;
+        float invZ = 1 / scaleZ;
+
+        r = Quaternion::CreateFromRotationMatrix
+        ({
+            M11*invX, M12*invX, M13*invX, 0,
+            M21*invY, M22*invY, M23*invY, 0,
+            M31*invZ, M32*invZ, M33*invZ, 0,
+                   0,	     0,		   0, 1.0f
+        });
+
+        s = Vector3(scaleX, scaleY, scaleZ);
+        t = Vector3(M41, M42, M43);
+
+        return true;
+        
+    }
+
+    YAX_INLINE float Matrix::Determinant() const
+    {
+#ifdef YAX_SSE
+        return _mm_cvtss_f32(SIMD::Determinant(SIMD::BlockMinors(&M11)));
+#else
+        return Detail::Minors(*this).Determinant();
+#endif
+    }
+
+    YAX_INLINE Matrix Matrix::CreateBillboard(const Vector3& objectPos, const Vector3& cameraPos,
+        const Vector3& cameraUp, const Vector3* cameraForward)
+    {
+        float minDist = 0.0001f * 0.0001f;
+        Vector3 xBasis, yBasis, zBasis;
+
+        Vector3 camToObj = objectPos - cameraPos;
+
+        zBasis = camToObj;
+        if (camToObj.LengthSquared() < minDist)
+        {
+            zBasis = (cameraForward != nullptr ? -(*cameraForward) : Vector3::Normalize(camToObj));
+        }
+
+        yBasis = Vector3::Normalize(cameraUp);
+        xBasis = Vector3::Normalize(Vector3::Cross(yBasis, zBasis));
+        zBasis.Normalize();
+
+        return Matrix(xBasis.X,    xBasis.Y,    xBasis.Z, 0,
+                      yBasis.X,    yBasis.Y,    yBasis.Z, 0,
+                      zBasis.X,    zBasis.Y,    zBasis.Z, 0,
+                   objectPos.X, objectPos.Y, objectPos.Z, 1.0f
+            );
+    }
+
+    YAX_INLINE Matrix Matrix::CreateConstrainedBillboard(const Vector3& objectPos, const Vector3& cameraPos,
+        const Vector3& rotAxis, const Vector3* cameraForward, const Vector3* objectForward)
+    {
+        float minDist = 0.0001f * 0.0001f;
+
+        Vector3 camToObj = objectPos - cameraPos;
+        Vector3 xBasis, yBasis, zBasis;
+
+        if (camToObj.LengthSquared() < minDist)
+        {
+            if (cameraForward != nullptr)
+                camToObj = -(*cameraForward);
+            else
+                camToObj = Vector3::Forward;
+        }
+
+        yBasis = Vector3::Normalize(rotAxis);
+        zBasis = camToObj;
+        float rotAxisDotZ = std::abs(Vector3::Dot(rotAxis, zBasis));
+
+        if (rotAxisDotZ > 0.999f)
+        {
+            if (objectForward != nullptr)
+            {
+                zBasis = *objectForward;
+                rotAxisDotZ = std::abs(Vector3::Dot(rotAxis, zBasis));
+            }
+        }
+
+        if (rotAxisDotZ > 0.999f)
+        {
+            zBasis = std::abs(Vector3::Dot(rotAxis, Vector3::Forward)) > 0.999f ? Vector3::Right : Vector3::Forward;
+        }
+
+        xBasis = Vector3::Normalize(Vector3::Cross(yBasis, zBasis));
+        zBasis = Vector3::Normalize(Vector3::Cross(xBasis, yBasis));
+
+        return Matrix(  xBasis.X,    xBasis.Y,    xBasis.Z, 0,
+                       rotAxis.X,   rotAxis.Y,   rotAxis.Z, 0,
+                        zBasis.X,    zBasis.Y,    zBasis.Z, 0,
+                     objectPos.X, objectPos.Y, objectPos.Z, 1.0f);
+
+    }
+
+    YAX_INLINE Matrix Matrix::CreateFromAxisAngle(const Vector3& axis, float angle)
+    {
+        float c = std::cos(angle);
+        float s = std::sin(angle);
+        float inv = 1.0f - c;
+
+        return Matrix(       axis.X*axis.X*inv + c, axis.X*axis.Y*inv + axis.Z*s, axis.X*axis.Z*inv - axis.Y*s, 0,
+                      axis.X*axis.Y*inv - axis.Z*s,        axis.Y*axis.Y*inv + c, axis.Y*axis.Z*inv + axis.X*s, 0,
+                      axis.X*axis.Z*inv + axis.Y*s, axis.Y*axis.Z*inv - axis.X*s,        axis.Z*axis.Z*inv + c, 0,
+                                                 0,							   0,							 0, 1.0f);
+    }
+
+    YAX_INLINE Matrix Matrix::CreateFromQuaternion(const Quaternion& q)
+    {
+        //variables for sanity
+        float x = q.X, y = q.Y, z = q.Z, w = q.W;
+
+        return Matrix(1-2*y*y-2*z*z,   2*x*y+2*z*w,   2*x*z-2*y*w,   0,
+                        2*x*y-2*z*w, 1-2*x*x-2*z*z,   2*y*z+2*x*w,   0,
+                        2*x*z+2*y*w,   2*y*z-2*x*w, 1-2*x*x-2*y*y,   0,
+                                  0,			 0,		        0, 1.0f);
+    }
+
+    YAX_INLINE void Matrix::CreateFromQuaternion(const Quaternion* rotations, const Vector3* scales, const Vector3* translations, Matrix* dest, ui32 count)
+    {
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 rows[4][4];
+            SIMD::QuaternionsToRows(&rotations[i].X, scales ? &scales[i].X : nullptr, translations ? &translations[i].X : nullptr, rows);
+
+            for (ui32 j = 0; j < 4; j++)
+            {
+                float* m = &dest[i + j].M11;
+                _mm_storeu_ps(m, rows[j][0]);
+                _mm_storeu_ps(m + 4, rows[j][1]);
+                _mm_storeu_ps(m + 8, rows[j][2]);
+                _mm_storeu_ps(m + 12, rows[j][3]);
+            }
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            Matrix m = CreateFromQuaternion(rotations[i]);
+
+            if (scales)
+            {
+                const Vector3& s = scales[i];
+                m.M11 *= s.X; m.M12 *= s.X; m.M13 *= s.X;
+                m.M21 *= s.Y; m.M22 *= s.Y; m.M23 *= s.Y;
+                m.M31 *= s.Z; m.M32 *= s.Z; m.M33 *= s.Z;
+            }
+
+            if (translations)
+            {
+                m.M41 = translations[i].X;
+                m.M42 = translations[i].Y;
+                m.M43 = translations[i].Z;
+            }
+
+            dest[i] = m;
+        }
+    }
+
+    YAX_INLINE Matrix Matrix::CreateFromYawPitchRoll(float y, float p, float r)
+    {
+        return CreateFromQuaternion(Quaternion::CreateFromYawPitchRoll(y, p, r));
+    }
+
+    YAX_INLINE Matrix Matrix::CreateLookAt(const Vector3& cameraPos, const Vector3& cameraTarg, const Vector3& cameraUp)
+    {
+        Vector3 zBasis = Vector3::Normalize(cameraTarg - cameraPos);
+        Vector3 xBasis = Vector3::Normalize(Vector3::Cross(cameraUp, zBasis));
+        Vector3 yBasis = Vector3::Normalize(Vector3::Cross(zBasis, xBasis));
+
+        float tX = -Vector3::Dot(cameraPos, xBasis);
+        float tY = -Vector3::Dot(cameraPos, yBasis);
+        float tZ = -Vector3::Dot(cameraPos, zBasis);
+
+        return Matrix(xBasis.X, xBasis.Y, xBasis.Z, 0,
+                      yBasis.X, yBasis.Y, yBasis.Z, 0,
+                      zBasis.X, zBasis.Y, zBasis.Z, 0,
+                            tX,		  tY,		tZ, 1.0f);
+    }
+
+    YAX_INLINE Matrix Matrix::CreatePerspective(float w, float h, float zN, float zF)
+    {
+        if (zN > zF) throw std::out_of_range("zNear must be less than or equal to zFar");
+        if (zN < 0 || zF < 0) throw std::out_of_range("zNear and zFar must be greater than 0");
+
+        return Matrix(2*zN/w,	   0,			  0, 0,
+                           0, 2*zN/h,			  0, 0,
+                           0,	   0,    zF/(zN-zF), -1.0f,
+                           0,	   0, zN*zF/(zN-zF), 0);
+    }
+
+    YAX_INLINE Matrix Matrix::CreatePerspectiveFieldOfView(float fov, float aR, float zN, float zF)
+    {
+        if (!(fov >= 0 && fov <= MathHelper::Pi)) throw std::out_of_range("fieldOfView must be between 0 and Pi radians (0 and 180 degrees)");
+        if (zN > zF) throw std::out_of_range("zNear must be less than or equal to zFar");
+        if (zN < 0 || zF < 0) throw std::out_of_range("zNear and zFar must be greater than 0");
+
+        float yScale = std::cos(fov / 2.0f) / std::sin(fov / 2.0f);
+        float xScale = yScale / aR;
+
+        return Matrix(xScale,	   0,			  0, 0,
+                           0, yScale,			  0, 0,
+                           0,	   0,    zF/(zN-zF), -1.0f,
+                           0,	   0, zN*zF/(zN-zF), 0);
+    }
+
+    YAX_INLINE Matrix Matrix::CreatePerspectiveOffCenter(float l, float r, float b, float t, float zN, float zF)
+    {
+        if (zN > zF) throw std::out_of_range("zNear must be less than or equal to zFar");
+        if (zN < 0 || zF < 0) throw std::out_of_range("zNear and zFar must be greater than 0");
+
+        return Matrix( 2*zN/(r-l),			 0,             0, 0,
+                                0,  2*zN/(t-b),             0, 0,
+                      (l+r)/(r-l), (t+b)/(t-b),    zF/(zN-zF), -1.0f,
+                                0,			 0, zN*zF/(zN-zF), 0);
+    }
+
+#ifdef YAX_GEOMETRY
+    YAX_INLINE Matrix Matrix::CreateReflection(const Plane& plane)
+    {
+        return CreateReflection(plane.Normal, plane.D);
+    }
+#endif
+
+    YAX_INLINE Matrix Matrix::CreateReflection(const Vector3& n, float dist)
+    {
+        float a = n.X, b = n.Y, c = n.Z, d = dist;
+
+        float ab = -2*a*b, ac = -2*a*c, ad = -2*a*d, bc = -2*b*c, bd = -2*b*d, cd = -2*c*d;
+
+        return Matrix(-2*a*a+1,		  ab,		ac, 0,
+                            ab, -2*b*b+1,		bc, 0,
+                            ac,		  bc, -2*c*c+1, 0,
+                            ad,		  bd,		cd, 1.0f);
+    
+    }
+
+    YAX_INLINE Matrix Matrix::CreateRotationX(float angle)
+    {
+        return CreateFromAxisAngle(Vector3::Right, angle);
+    }
+
+    YAX_INLINE Matrix Matrix::CreateRotationY(float angle)
+    {
+        return CreateFromAxisAngle(Vector3::Up, angle);
+    }
+
+    YAX_INLINE Matrix Matrix::CreateRotationZ(float angle)
+    {
+        return CreateFromAxisAngle(Vector3::Backward, angle);
+    }
+
+#ifdef YAX_GEOMETRY
+    YAX_INLINE Matrix Matrix::CreateShadow(const Vector3& lightDir, const Plane& plane)
+    {
+        return CreateShadow(lightDir, plane.Normal, plane.D);
+    }
+#endif
+
+    YAX_INLINE Matrix Matrix::CreateShadow(const Vector3& lightDir, const Vector3& pN, float d)
+    {
+        Vector3 l = -lightDir;
+        float s = -Vector3::Dot(l, pN);
+        return Matrix(pN.X*l.X+s,   pN.X*l.Y,   pN.X*l.Z,     0,
+                        pN.Y*l.X, pN.Y*l.Y+s,   pN.Y*l.Z,     0, 
+                        pN.Z*l.X,   pN.Z*l.Y,   pN.Z*l.Z + s, 0,
+                           d*l.X,      d*l.Y,	   d*l.Z,     s);
+    
+    }
+
+    YAX_INLINE Matrix Matrix::CreateWorld(Vector3 pos, Vector3 fwd, Vector3 up)
+    {
+        fwd.Normalize();
+        up.Normalize();
+        Vector3 r = Vector3::Normalize(Vector3::Cross(fwd, up));
+
+        return Matrix(   r.X,    r.Y,    r.Z, 0,
+                        up.X,   up.Y,   up.Z, 0,
+                      -fwd.X, -fwd.Y, -fwd.Z, 0,
+                       pos.X,  pos.Y,  pos.Z, 1.0f);
+    }
+
+    namespace Detail
+    {
+#ifdef YAX_SSE
+        YAX_INLINE Matrix StoreRows(const __m128 rows[4])
+        {
+            Matrix m = Matrix::Identity;
+            _mm_storeu_ps(&m.M11, rows[0]);
+            _mm_storeu_ps(&m.M21, rows[1]);
+            _mm_storeu_ps(&m.M31, rows[2]);
+            _mm_storeu_ps(&m.M41, rows[3]);
+            return m;
+        }
+#endif
+
+        //Calculates the adjugate of a matrix, and its determinant as a by-product
+        YAX_INLINE Matrix Adjugate(const Matrix& m, float& det)
+        {
+#ifdef YAX_SSE
+            __m128 rows[4];
+            det = _mm_cvtss_f32(SIMD::Adjugate(&m.M11, rows));
+            return Detail::StoreRows(rows);
+#else
+            Minors mn(m);
+            float s0 = mn.s0, s1 = mn.s1, s2 = mn.s2, s3 = mn.s3, s4 = mn.s4, s5 = mn.s5;
+            float c0 = mn.c0, c1 = mn.c1, c2 = mn.c2, c3 = mn.c3, c4 = mn.c4, c5 = mn.c5;
+
+            det = mn.Determinant();
+
+            return Matrix(m.M22*c5 - m.M23*c4 + m.M24*c3, -m.M12*c5 + m.M13*c4 - m.M14*c3, m.M42*s5 - m.M43*s4 + m.M44*s3, -m.M32*s5 + m.M33*s4 - m.M34*s3,
+                          -m.M21*c5 + m.M23*c2 - m.M24*c1, m.M11*c5 - m.M13*c2 + m.M14*c1, -m.M41*s5 + m.M43*s2 - m.M44*s1, m.M31*s5 - m.M33*s2 + m.M34*s1,
+                          m.M21*c4 - m.M22*c2 + m.M24*c0, -m.M11*c4 + m.M12*c2 - m.M14*c0, m.M41*s4 - m.M42*s2 + m.M44*s0, -m.M31*s4 + m.M32*s2 - m.M34*s0,
+                          -m.M21*c3 + m.M22*c1 - m.M23*c0, m.M11*c3 - m.M12*c1 + m.M13*c0, -m.M41*s3 + m.M42*s1 - m.M43*s0, m.M31*s3 - m.M32*s1 + m.M33*s0);
+#endif
+        }
+
+        //The product of the lengths of the first n columns of each row, the bound on the determinant IsSingular compares against
+        YAX_INLINE float RowLengthProduct(const Matrix& m, ui32 n)
+        {
+            const float* row = &m.M11;
+            float product = 1.0f;
+
+            for (ui32 i = 0; i < n; i++, row += 4)
+            {
+                float lenSq = 0.0f;
+
+                for (ui32 j = 0; j < n; j++)
+                    lenSq += row[j]*row[j];
+
+                product *= std::sqrt(lenSq);
+            }
+
+            return product;
+        }
+
+        //Inverts the upper 3x3 of an affine matrix and back-substitutes the translation
+        YAX_INLINE Matrix AffineInverse(const Matrix& m, float& det)
+        {
+#ifdef YAX_SSE
+            __m128 rows[4];
+            det = _mm_cvtss_f32(SIMD::InvertAffine(&m.M11, rows));
+            return Detail::StoreRows(rows);
+#else
+            //Rows of the 3x3 cofactor matrix
+            float c11 = m.M22*m.M33 - m.M23*m.M32;
+            float c12 = m.M23*m.M31 - m.M21*m.M33;
+            float c13 = m.M21*m.M32 - m.M22*m.M31;
+            float c21 = m.M32*m.M13 - m.M33*m.M12;
+            float c22 = m.M33*m.M11 - m.M31*m.M13;
+            float c23 = m.M31*m.M12 - m.M32*m.M11;
+            float c31 = m.M12*m.M23 - m.M13*m.M22;
+            float c32 = m.M13*m.M21 - m.M11*m.M23;
+            float c33 = m.M11*m.M22 - m.M12*m.M21;
+
+            det = m.M11*c11 + m.M12*c12 + m.M13*c13;
+            float inv = 1 / det;
+
+            return Matrix(c11*inv, c21*inv, c31*inv, 0,
+                          c12*inv, c22*inv, c32*inv, 0,
+                          c13*inv, c23*inv, c33*inv, 0,
+                          -(m.M41*c11 + m.M42*c12 + m.M43*c13)*inv,
+                          -(m.M41*c21 + m.M42*c22 + m.M43*c23)*inv,
+                          -(m.M41*c31 + m.M42*c32 + m.M43*c33)*inv, 1.0f);
+#endif
+        }
+    }
+
+    YAX_INLINE Matrix Matrix::Invert(const Matrix& m)
+    {
+        float det;
+        Matrix adj = Detail::Adjugate(m, det);
+        return (1 / det)*adj;
+    }
+
+    YAX_INLINE bool Matrix::Invert(const Matrix& m, Matrix& result, float* determinant)
+    {
+        return Invert(m, result, determinant, nullptr);
+    }
+
+    YAX_INLINE bool Matrix::Invert(const Matrix& m, Matrix& result, float* determinant, Matrix* cofactor)
+    {
+        float det;
+        Matrix adj = Detail::Adjugate(m, det);
+
+        if (determinant != nullptr)
+            *determinant = det;
+
+        if (cofactor != nullptr)
+            *cofactor = Transpose(adj);
+
+        if (Detail::IsSingular(det, Detail::RowLengthProduct(m, 4)))
+            return false;
+
+        result = (1 / det)*adj;
+        return true;
+    }
+
+    YAX_INLINE bool Matrix::Invert(const Matrix* source, Matrix* dest, float* determinants, Matrix* cofactors, ui32 count)
+    {
+        bool allInvertible = true;
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            allInvertible &= Invert(source[i], dest[i],
+                                    determinants != nullptr ? &determinants[i] : nullptr,
+                                    cofactors != nullptr ? &cofactors[i] : nullptr);
+        }
+
+        return allInvertible;
+    }
+
+    YAX_INLINE Matrix Matrix::InvertAffine(const Matrix& m)
+    {
+        float det;
+        return Detail::AffineInverse(m, det);
+    }
+
+    YAX_INLINE bool Matrix::InvertAffine(const Matrix& m, Matrix& result, float* determinant)
+    {
+        float det;
+        Matrix inv = Detail::AffineInverse(m, det);
+
+        if (determinant != nullptr)
+            *determinant = det;
+
+        if (Detail::IsSingular(det, Detail::RowLengthProduct(m, 3)))
+            return false;
+
+        result = inv;
+        return true;
+    }
+
+    YAX_INLINE Matrix Matrix::InvertRigid(const Matrix& m)
+    {
+#ifdef YAX_SSE
+        __m128 rows[4];
+        SIMD::InvertRigid(&m.M11, rows);
+        return Detail::StoreRows(rows);
+#else
+        //The rotation's inverse is its transpose, and the translation is rotated back by it
+        return Matrix(m.M11, m.M21, m.M31, 0,
+                      m.M12, m.M22, m.M32, 0,
+                      m.M13, m.M23, m.M33, 0,
+                      -(m.M41*m.M11 + m.M42*m.M12 + m.M43*m.M13),
+                      -(m.M41*m.M21 + m.M42*m.M22 + m.M43*m.M23),
+                      -(m.M41*m.M31 + m.M42*m.M32 + m.M43*m.M33), 1.0f);
+#endif
+    }
+
+    YAX_INLINE void Matrix::Multiply(const Matrix* source, const Matrix& mat, Matrix* dest, ui32 count)
+    {
+#ifdef YAX_SSE
+        SIMD::MatrixOperand b(&mat.M11);
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            SIMD::MultiplyMatrix(&source[i].M11, b, &dest[i].M11);
+        }
+#else
+        Matrix b = mat;
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            dest[i] = source[i] * b;
+        }
+#endif
+    }
+
+    YAX_INLINE void Matrix::Multiply(const Matrix* source1, const Matrix* source2, Matrix* dest, ui32 count)
+    {
+        for (ui32 i = 0; i < count; i++)
+        {
+#ifdef YAX_SSE
+            SIMD::MultiplyMatrix(&source1[i].M11, &source2[i].M11, &dest[i].M11);
+#else
+            dest[i] = source1[i] * source2[i];
+#endif
+        }
+    }
+
+    YAX_INLINE void Matrix::TransposeInto(const Matrix* source, float* dest, ui32 destStride, ui32 count, bool truncate)
+    {
+        ui32 rows = truncate ? 3 : 4;
+        char* out = reinterpret_cast<char*>(dest);
+
+#ifdef YAX_SSE
+        //Non-temporal stores need 16-byte aligned addresses
+        bool stream = (reinterpret_cast<std::uintptr_t>(dest) % 16 == 0) && (destStride % 16 == 0);
+
+        for (ui32 i = 0; i < count; i++, out += destStride)
+        {
+            __m128 r[4] = { _mm_loadu_ps(&source[i].M11), _mm_loadu_ps(&source[i].M21),
+                            _mm_loadu_ps(&source[i].M31), _mm_loadu_ps(&source[i].M41) };
+            _MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+
+            float* m = reinterpret_cast<float*>(out);
+
+            if (stream)
+            {
+                for (ui32 j = 0; j < rows; j++)
+                    _mm_stream_ps(m + 4*j, r[j]);
+            }
+            else
+            {
+                for (ui32 j = 0; j < rows; j++)
+                    _mm_storeu_ps(m + 4*j, r[j]);
+            }
+        }
+
+        //Make the streamed data visible before anything else touches the buffer
+        if (stream)
+            _mm_sfence();
+#else
+        for (ui32 i = 0; i < count; i++, out += destStride)
+        {
+            const float* src = &source[i].M11;
+            float* m = reinterpret_cast<float*>(out);
+
+            for (ui32 j = 0; j < rows; j++)
+            {
+                for (ui32 k = 0; k < 4; k++)
+                    m[4*j + k] = src[4*k + j];
+            }
+        }
+#endif
+    }
+
+    YAX_INLINE Matrix Matrix::Transform(const Matrix& m, const Quaternion& r)
+    {
+        return m*CreateFromQuaternion(r);
+    }
+
+    YAX_INLINE Matrix& Matrix::operator+=(const Matrix& m)
+    {
+        this->M11 += m.M11;
+        this->M12 += m.M12;
+        this->M13 += m.M13;
+        this->M14 += m.M14;
+        this->M21 += m.M21;
+        this->M22 += m.M22;
+        this->M23 += m.M23;
+        this->M24 += m.M24;
+        this->M31 += m.M31;
+        this->M32 += m.M32;
+        this->M33 += m.M33;
+        this->M34 += m.M34;
+        this->M41 += m.M41;
+        this->M42 += m.M42;
+        this->M43 += m.M43;
+        this->M44 += m.M44;
+
+        return *this;
+    }
+
+    YAX_INLINE Matrix& Matrix::operator-=(const Matrix& m)
+    {
+        this->M11 -= m.M11;
+        this->M12 -= m.M12;
+        this->M13 -= m.M13;
+        this->M14 -= m.M14;
+        this->M21 -= m.M21;
+        this->M22 -= m.M22;
+        this->M23 -= m.M23;
+        this->M24 -= m.M24;
+        this->M31 -= m.M31;
+        this->M32 -= m.M32;
+        this->M33 -= m.M33;
+        this->M34 -= m.M34;
+        this->M41 -= m.M41;
+        this->M42 -= m.M42;
+        this->M43 -= m.M43;
+        this->M44 -= m.M44;
+
+        return *this;
+    }
+
+    YAX_INLINE Matrix& Matrix::operator*=(const Matrix& m)
+    {
+#ifdef YAX_SSE
+        SIMD::MultiplyMatrix(&M11, &m.M11, &M11);
+#else
+        float m11 = M11*m.M11 + M12*m.M21 + M13*m.M31 + M14*m.M41;
+        float m12 = M11*m.M12 + M12*m.M22 + M13*m.M32 + M14*m.M42;
+        float m13 = M11*m.M13 + M12*m.M23 + M13*m.M33 + M14*m.M43;
+        float m14 = M11*m.M14 + M12*m.M24 + M13*m.M34 + M14*m.M44;
+        float m21 = M21*m.M11 + M22*m.M21 + M23*m.M31 + M24*m.M41;
+        float m22 = M21*m.M12 + M22*m.M22 + M23*m.M32 + M24*m.M42;
+        float m23 = M21*m.M13 + M22*m.M23 + M23*m.M33 + M24*m.M43;
+        float m24 = M21*m.M14 + M22*m.M24 + M23*m.M34 + M24*m.M44;
+        float m31 = M31*m.M11 + M32*m.M21 + M33*m.M31 + M34*m.M41;
+        float m32 = M31*m.M12 + M32*m.M22 + M33*m.M32 + M34*m.M42;
+        float m33 = M31*m.M13 + M32*m.M23 + M33*m.M33 + M34*m.M43;
+        float m34 = M31*m.M14 + M32*m.M24 + M33*m.M34 + M34*m.M44;
+        float m41 = M41*m.M11 + M42*m.M21 + M43*m.M31 + M44*m.M41;
+        float m42 = M41*m.M12 + M42*m.M22 + M43*m.M32 + M44*m.M42;
+        float m43 = M41*m.M13 + M42*m.M23 + M43*m.M33 + M44*m.M43;
+        float m44 = M41*m.M14 + M42*m.M24 + M43*m.M34 + M44*m.M44;
+
+        this->M11 = m11;
+        this->M12 = m12;
+        this->M13 = m13;
+        this->M14 = m14;
+        this->M21 = m21;
+        this->M22 = m22;
+        this->M23 = m23;
+        this->M24 = m24;
+        this->M31 = m31;
+        this->M32 = m32;
+        this->M33 = m33;
+        this->M34 = m34;
+        this->M41 = m41;
+        this->M42 = m42;
+        this->M43 = m43;
+        this->M44 = m44;
+#endif
+
+        return *this;
+    }
+
+    YAX_INLINE Matrix& Matrix::operator*=(float f)
+    {
+        this->M11 *= f;
+        this->M12 *= f;
+        this->M13 *= f;
+        this->M14 *= f;
+        this->M21 *= f;
+        this->M22 *= f;
+        this->M23 *= f;
+        this->M24 *= f;
+        this->M31 *= f;
+        this->M32 *= f;
+        this->M33 *= f;
+        this->M34 *= f;
+        this->M41 *= f;
+        this->M42 *= f;
+        this->M43 *= f;
+        this->M44 *= f;
+
+        return *this;
+    }
+
+    YAX_INLINE Matrix& Matrix::operator/=(const Matrix& m)
+    {
+        this->M11 /= m.M11;
+        this->M12 /= m.M12;
+        this->M13 /= m.M13;
+        this->M14 /= m.M14;
+        this->M21 /= m.M21;
+        this->M22 /= m.M22;
+        this->M23 /= m.M23;
+        this->M24 /= m.M24;
+        this->M31 /= m.M31;
+        this->M32 /= m.M32;
+        this->M33 /= m.M33;
+        this->M34 /= m.M34;
+        this->M41 /= m.M41;
+        this->M42 /= m.M42;
+        this->M43 /= m.M43;
+        this->M44 /= m.M44;
+
+        return *this;
+    }
+
+    YAX_INLINE Matrix& Matrix::operator/=(float f)
+    {
+        this->M11 /= f;
+        this->M12 /= f;
+        this->M13 /= f;
+        this->M14 /= f;
+        this->M21 /= f;
+        this->M22 /= f;
+        this->M23 /= f;
+        this->M24 /= f;
+        this->M31 /= f;
+        this->M32 /= f;
+        this->M33 /= f;
+        this->M34 /= f;
+        this->M41 /= f;
+        this->M42 /= f;
+        this->M43 /= f;
+        this->M44 /= f;
+
+        return *this;
+    }
+
+    YAX_INLINE Matrix operator+(Matrix lhs, const Matrix& rhs)
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Matrix operator-(Matrix lhs, const Matrix& rhs)
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Matrix operator*(Matrix lhs, const Matrix& rhs)
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Matrix operator*(float lhs, const Matrix& rhs)
+    {
+        return rhs*lhs;
+    }
+
+    YAX_INLINE Matrix operator*(Matrix lhs, float rhs)
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Matrix operator/(Matrix lhs, const Matrix& rhs)
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Matrix operator/(Matrix lhs, float rhs)
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Matrix operator-(Matrix rhs)
+    {
+        rhs.M11 = -rhs.M11;
+        rhs.M12 = -rhs.M12;
+        rhs.M13 = -rhs.M13;
+        rhs.M14 = -rhs.M14;
+        rhs.M21 = -rhs.M21;
+        rhs.M22 = -rhs.M22;
+        rhs.M23 = -rhs.M23;
+        rhs.M24 = -rhs.M24;
+        rhs.M31 = -rhs.M31;
+        rhs.M32 = -rhs.M32;
+        rhs.M33 = -rhs.M33;
+        rhs.M34 = -rhs.M34;
+        rhs.M41 = -rhs.M41;
+        rhs.M42 = -rhs.M42;
+        rhs.M43 = -rhs.M43;
+        rhs.M44 = -rhs.M44;
+
+        return rhs;
+    }
+
+    YAX_INLINE bool operator==(const Matrix& lhs, const Matrix& rhs)
+    {
+        using MathHelper::EqualWithinEpsilon;
+
+        return EqualWithinEpsilon(lhs.M11, rhs.M11) &&
+               EqualWithinEpsilon(lhs.M12, rhs.M12) &&
+               EqualWithinEpsilon(lhs.M13, rhs.M13) &&
+               EqualWithinEpsilon(lhs.M14, rhs.M14) &&
+               EqualWithinEpsilon(lhs.M21, rhs.M21) &&
+               EqualWithinEpsilon(lhs.M22, rhs.M22) &&
+               EqualWithinEpsilon(lhs.M23, rhs.M23) &&
+               EqualWithinEpsilon(lhs.M24, rhs.M24) &&
+               EqualWithinEpsilon(lhs.M31, rhs.M31) &&
+               EqualWithinEpsilon(lhs.M32, rhs.M32) &&
+               EqualWithinEpsilon(lhs.M33, rhs.M33) &&
+               EqualWithinEpsilon(lhs.M34, rhs.M34) &&
+               EqualWithinEpsilon(lhs.M41, rhs.M41) &&
+               EqualWithinEpsilon(lhs.M42, rhs.M42) &&
+               EqualWithinEpsilon(lhs.M43, rhs.M43) &&
+               EqualWithinEpsilon(lhs.M44, rhs.M44);
+    }
+
+    YAX_INLINE bool operator!=(const Matrix& lhs, const Matrix& rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
\ No newline at end of file
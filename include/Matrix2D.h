@@ -0,0 +1,189 @@
+#ifndef _MATRIX2D_H
+#define _MATRIX2D_H
+
+#include "Parallel.h"
+#include "Utils.h"
+
+namespace YAX
+{
+    struct Matrix;
+    struct Vector2;
+
+    /**
+    * @brief A row-major 3x2 matrix for 2D affine transformations of Vector2s
+    *
+    * The first two rows are the linear part and the third row is the translation, laid out like the
+    * corresponding elements of a Matrix (M31, M32 here are M41, M42 there). Transforming a point takes
+    * 4 multiplies instead of 16, and concatenating two transforms takes 12 instead of 64.
+    */
+    struct Matrix2D
+    {
+        static const Matrix2D Identity;
+
+        float M11, M12,
+              M21, M22,
+              M31, M32;
+
+        Matrix2D() = default;
+        constexpr Matrix2D(float m11, float m12,
+                           float m21, float m22,
+                           float m31, float m32);
+
+        /**
+        * @brief Converts the transform to a Matrix that applies it to the XY plane
+        */
+        constexpr Matrix ToMatrix() const;
+
+        /**
+        * @brief Creates a 2D transform from the XY part of a matrix
+        *
+        * The conversion is lossless if mat only transforms within the XY plane.
+        *
+        * @param mat The matrix to convert
+        * @return The 2D transform
+        */
+        static constexpr Matrix2D CreateFromMatrix(const Matrix& mat);
+
+        /**
+        * @brief Creates a rotation about the origin, matching the XY part of Matrix::CreateRotationZ
+        *
+        * @param radians The angle of rotation in radians
+        * @return The rotation transform
+        */
+        static Matrix2D CreateRotation(float radians);
+
+        /**
+        * @brief Creates a scale transform
+        *
+        * @param x, y The scale factors along each axis
+        * @return The scale transform
+        */
+        static constexpr Matrix2D CreateScale(float x, float y);
+
+        /**
+        * @brief Creates a translation transform
+        *
+        * @param x, y The translation along each axis
+        * @return The translation transform
+        */
+        static constexpr Matrix2D CreateTranslation(float x, float y);
+
+        /**
+        * @brief Finds the inverse of a 2D transform
+        *
+        * @param transform The transform to find the inverse of
+        * @return The inverted transform
+        */
+        static Matrix2D Invert(const Matrix2D& transform);
+
+        /**
+        * @brief Finds the inverse of a 2D transform and reports whether it is singular
+        *
+        * @param transform The transform to find the inverse of
+        * @param result Output parameter for the inverted transform; left unchanged if transform is singular
+        * @param determinant Optional output parameter for the determinant of transform; Pass nullptr if not needed
+        * @return true if transform is invertible, false if it is singular
+        */
+        static bool Invert(const Matrix2D& transform, Matrix2D& result, float* determinant);
+
+        /**
+        * @brief Transforms a point by a 2D transform
+        *
+        * @param point The point to transform
+        * @param transform The transformation to apply
+        * @return The transformed point
+        */
+        static Vector2 TransformPoint(const Vector2& point, const Matrix2D& transform);
+
+        /**
+        * @brief Transforms an array of points by a 2D transform
+        *
+        * @param source The array of points to transform, e.g. the corners of sprite quads
+        * @param transform The transformation to apply
+        * @param dest The array to store the transformed points in; may be the same array as source
+        * @param count The number of points to transform
+        */
+        static void TransformPoint(const Vector2* source, const Matrix2D& transform, Vector2* dest, ui32 count);
+
+        /**
+        * @brief Transforms an array of points by a 2D transform, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The array of points to transform, e.g. the corners of sprite quads
+        * @param transform The transformation to apply
+        * @param dest The array to store the transformed points in; may be the same array as source
+        * @param count The number of points to transform
+        */
+        static void TransformPoint(ExecutionPolicy policy, const Vector2* source, const Matrix2D& transform, Vector2* dest, ui32 count);
+
+        /**
+        * @brief Transforms a direction vector by a 2D transform without applying translation
+        *
+        * @param normal The vector to transform
+        * @param transform The transformation to apply
+        * @return The transformed vector
+        */
+        static Vector2 TransformNormal(const Vector2& normal, const Matrix2D& transform);
+
+        Matrix2D& operator*=(const Matrix2D&);
+    };
+
+    Matrix2D operator*(Matrix2D, const Matrix2D&);
+
+    bool operator==(const Matrix2D&, const Matrix2D&);
+    bool operator!=(const Matrix2D&, const Matrix2D&);
+}
+
+//Included after the declarations above so that the headers can depend on each other
+#include "Matrix.h"
+#include "Vector2.h"
+
+namespace YAX
+{
+    constexpr Matrix2D::Matrix2D(float m11, float m12,
+                                 float m21, float m22,
+                                 float m31, float m32)
+        : M11(m11), M12(m12),
+          M21(m21), M22(m22),
+          M31(m31), M32(m32)
+    {}
+
+    constexpr Matrix Matrix2D::ToMatrix() const
+    {
+        return Matrix(M11, M12, 0.0f, 0.0f,
+                      M21, M22, 0.0f, 0.0f,
+                      0.0f, 0.0f, 1.0f, 0.0f,
+                      M31, M32, 0.0f, 1.0f);
+    }
+
+    constexpr Matrix2D Matrix2D::CreateFromMatrix(const Matrix& m)
+    {
+        return Matrix2D(m.M11, m.M12,
+                        m.M21, m.M22,
+                        m.M41, m.M42);
+    }
+
+    constexpr Matrix2D Matrix2D::CreateScale(float x, float y)
+    {
+        return Matrix2D(x, 0.0f,
+                        0.0f, y,
+                        0.0f, 0.0f);
+    }
+
+    constexpr Matrix2D Matrix2D::CreateTranslation(float x, float y)
+    {
+        return Matrix2D(1.0f, 0.0f,
+                        0.0f, 1.0f,
+                        x, y);
+    }
+
+    constexpr Matrix2D Matrix2D::Identity = Matrix2D(1.0f, 0.0f,
+                                                     0.0f, 1.0f,
+                                                     0.0f, 0.0f);
+}
+
+#ifdef YAX_MATH_INLINE
+#include "Matrix2D.inl"
+#endif
+
+#endif
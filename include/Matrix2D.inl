@@ -0,0 +1,165 @@
+#include <cmath>
+#include "MathHelper.h"
+#include "SIMD.h"
+#include "Vector2.h"
+
+namespace YAX
+{
+    static_assert(sizeof(Matrix2D) == 6 * sizeof(float), "Matrix2D must be 6 tightly packed floats");
+
+#if defined(YAX_SSE)
+    namespace Detail
+    {
+        //The AVX part of Matrix2D::TransformPoint, four points per register and two per 128-bit lane, with the sums in
+        //the same order as the scalar code. Compiled for AVX even when the rest of the library isn't; only call it if
+        //SIMD::SupportsAVX(). Returns the number of points transformed.
+        YAX_INLINE YAX_TARGET_AVX ui32 TransformPointsAVX(const Vector2* source, const Matrix2D& t, Vector2* dest, ui32 count)
+        {
+            __m256 row0 = _mm256_setr_ps(t.M11, t.M12, t.M11, t.M12, t.M11, t.M12, t.M11, t.M12);
+            __m256 row1 = _mm256_setr_ps(t.M21, t.M22, t.M21, t.M22, t.M21, t.M22, t.M21, t.M22);
+            __m256 row2 = _mm256_setr_ps(t.M31, t.M32, t.M31, t.M32, t.M31, t.M32, t.M31, t.M32);
+            ui32 i = 0;
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m256 p = _mm256_loadu_ps(&source[i].X);
+                __m256 x = _mm256_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+                __m256 y = _mm256_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+                _mm256_storeu_ps(&dest[i].X, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, row0), _mm256_mul_ps(y, row1)), row2));
+            }
+
+            return i;
+        }
+    }
+#endif
+
+    YAX_INLINE Matrix2D Matrix2D::CreateRotation(float radians)
+    {
+        float c = std::cos(radians);
+        float s = std::sin(radians);
+
+        return Matrix2D(c, s,
+                        -s, c,
+                        0.0f, 0.0f);
+    }
+
+    namespace Detail
+    {
+        YAX_INLINE Matrix2D InvertMatrix2D(const Matrix2D& m, float& det)
+        {
+            det = m.M11*m.M22 - m.M12*m.M21;
+
+            float inv = 1 / det;
+            float i11 = m.M22*inv, i12 = -m.M12*inv;
+            float i21 = -m.M21*inv, i22 = m.M11*inv;
+
+            //The translation is moved back through the inverted linear part
+            return Matrix2D(i11, i12,
+                            i21, i22,
+                            -(m.M31*i11 + m.M32*i21),
+                            -(m.M31*i12 + m.M32*i22));
+        }
+    }
+
+    YAX_INLINE Matrix2D Matrix2D::Invert(const Matrix2D& transform)
+    {
+        float det;
+        return Detail::InvertMatrix2D(transform, det);
+    }
+
+    YAX_INLINE bool Matrix2D::Invert(const Matrix2D& transform, Matrix2D& result, float* determinant)
+    {
+        float det;
+        Matrix2D inv = Detail::InvertMatrix2D(transform, det);
+
+        if (determinant != nullptr)
+            *determinant = det;
+
+        float rowLengthProduct = std::sqrt(transform.M11*transform.M11 + transform.M12*transform.M12) *
+                                 std::sqrt(transform.M21*transform.M21 + transform.M22*transform.M22);
+
+        if (Detail::IsSingular(det, rowLengthProduct))
+            return false;
+
+        result = inv;
+        return true;
+    }
+
+    YAX_INLINE Vector2 Matrix2D::TransformPoint(const Vector2& p, const Matrix2D& t)
+    {
+        return Vector2(p.X*t.M11 + p.Y*t.M21 + t.M31,
+                       p.X*t.M12 + p.Y*t.M22 + t.M32);
+    }
+
+    YAX_INLINE void Matrix2D::TransformPoint(const Vector2* source, const Matrix2D& transform, Vector2* dest, ui32 count)
+    {
+        Matrix2D t = transform;
+        ui32 i = 0;
+
+#if defined(YAX_SSE)
+        if (SIMD::SupportsAVX())
+            i = Detail::TransformPointsAVX(source, t, dest, count);
+
+        //Two points per register
+        __m128 r0 = _mm_setr_ps(t.M11, t.M12, t.M11, t.M12);
+        __m128 r1 = _mm_setr_ps(t.M21, t.M22, t.M21, t.M22);
+        __m128 r2 = _mm_setr_ps(t.M31, t.M32, t.M31, t.M32);
+
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128 p = _mm_loadu_ps(&source[i].X);
+            __m128 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+            __m128 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+            _mm_storeu_ps(&dest[i].X, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, r0), _mm_mul_ps(y, r1)), r2));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            dest[i] = TransformPoint(source[i], t);
+        }
+    }
+
+    YAX_INLINE void Matrix2D::TransformPoint(ExecutionPolicy policy, const Vector2* source, const Matrix2D& transform, Vector2* dest, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(2 * sizeof(Vector2)), [&](ui32 begin, ui32 end)
+        {
+            TransformPoint(source + begin, transform, dest + begin, end - begin);
+        });
+    }
+
+    YAX_INLINE Vector2 Matrix2D::TransformNormal(const Vector2& n, const Matrix2D& t)
+    {
+        return Vector2(n.X*t.M11 + n.Y*t.M21,
+                       n.X*t.M12 + n.Y*t.M22);
+    }
+
+    YAX_INLINE Matrix2D& Matrix2D::operator*=(const Matrix2D& m)
+    {
+        *this = Matrix2D(M11*m.M11 + M12*m.M21, M11*m.M12 + M12*m.M22,
+                         M21*m.M11 + M22*m.M21, M21*m.M12 + M22*m.M22,
+                         M31*m.M11 + M32*m.M21 + m.M31, M31*m.M12 + M32*m.M22 + m.M32);
+        return *this;
+    }
+
+    YAX_INLINE Matrix2D operator*(Matrix2D lhs, const Matrix2D& rhs)
+    {
+        return lhs *= rhs;
+    }
+
+    YAX_INLINE bool operator==(const Matrix2D& lhs, const Matrix2D& rhs)
+    {
+        using MathHelper::EqualWithinEpsilon;
+
+        return EqualWithinEpsilon(lhs.M11, rhs.M11) &&
+               EqualWithinEpsilon(lhs.M12, rhs.M12) &&
+               EqualWithinEpsilon(lhs.M21, rhs.M21) &&
+               EqualWithinEpsilon(lhs.M22, rhs.M22) &&
+               EqualWithinEpsilon(lhs.M31, rhs.M31) &&
+               EqualWithinEpsilon(lhs.M32, rhs.M32);
+    }
+
+    YAX_INLINE bool operator!=(const Matrix2D& lhs, const Matrix2D& rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef _MATRIXA_H
+#define _MATRIXA_H
+
+#include "Utils.h"
+
+namespace YAX
+{
+    struct Matrix;
+
+    /**
+    * @brief A 32-byte aligned Matrix, for storage that is fed to SIMD code
+    *
+    * Converts freely to and from Matrix. Only the hot operations are provided here;
+    * convert to Matrix for everything else.
+    */
+    struct alignas(32) MatrixA
+    {
+        float M11, M12, M13, M14,
+              M21, M22, M23, M24,
+              M31, M32, M33, M34,
+              M41, M42, M43, M44;
+
+        MatrixA() = default;
+        constexpr MatrixA(const Matrix& m);
+
+        constexpr operator Matrix() const;
+
+        /**
+        * @brief Multiplies every matrix in an array by the same matrix
+        *
+        * @param source The array of left-hand matrices
+        * @param mat The right-hand matrix
+        * @param dest The array to store the products in; may be the same array as source
+        * @param count The number of matrices to multiply
+        */
+        static void Multiply(const MatrixA* source, const MatrixA& mat, MatrixA* dest, ui32 count);
+
+        MatrixA& operator*=(const MatrixA&);
+    };
+
+    MatrixA operator*(const MatrixA&, const MatrixA&);
+}
+
+//Included after the declarations above so that the headers can depend on each other
+#include "Matrix.h"
+
+namespace YAX
+{
+    constexpr MatrixA::MatrixA(const Matrix& m)
+        : M11(m.M11), M12(m.M12), M13(m.M13), M14(m.M14),
+          M21(m.M21), M22(m.M22), M23(m.M23), M24(m.M24),
+          M31(m.M31), M32(m.M32), M33(m.M33), M34(m.M34),
+          M41(m.M41), M42(m.M42), M43(m.M43), M44(m.M44)
+    {}
+
+    constexpr MatrixA::operator Matrix() const
+    {
+        return Matrix(M11, M12, M13, M14,
+                      M21, M22, M23, M24,
+                      M31, M32, M33, M34,
+                      M41, M42, M43, M44);
+    }
+}
+
+#ifdef YAX_MATH_INLINE
+#include "MatrixA.inl"
+#endif
+
+#endif
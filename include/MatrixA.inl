@@ -0,0 +1,43 @@
+#include "Matrix.h"
+#include "SIMD.h"
+
+namespace YAX
+{
+    static_assert(sizeof(MatrixA) == 16 * sizeof(float), "MatrixA must be 16 tightly packed floats");
+
+    YAX_INLINE void MatrixA::Multiply(const MatrixA* source, const MatrixA& mat, MatrixA* dest, ui32 count)
+    {
+#ifdef YAX_SSE
+        SIMD::MatrixOperand b(&mat.M11);
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            SIMD::MultiplyMatrixAligned(&source[i].M11, b, &dest[i].M11);
+        }
+#else
+        MatrixA b = mat;
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            dest[i] = source[i] * b;
+        }
+#endif
+    }
+
+    YAX_INLINE MatrixA& MatrixA::operator*=(const MatrixA& m)
+    {
+#ifdef YAX_SSE
+        SIMD::MultiplyMatrixAligned(&M11, SIMD::MatrixOperand(&m.M11), &M11);
+#else
+        Matrix product = Matrix(*this) * Matrix(m);
+        *this = product;
+#endif
+        return *this;
+    }
+
+    YAX_INLINE MatrixA operator*(const MatrixA& m1, const MatrixA& m2)
+    {
+        MatrixA res = m1;
+        return res *= m2;
+    }
+}
@@ -0,0 +1,138 @@
+#ifndef _MATRIX_EXPRESSION_H
+#define _MATRIX_EXPRESSION_H
+
+#include "Matrix.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+//Opt-in expression templates for chains of matrix products.
+//
+//Wrapping the first matrix of a chain in Lazy() makes every following operator* build an expression
+//instead of a Matrix:
+//
+//    Vector3 p = Vector3::Transform(v, Lazy(world) * view * proj);
+//
+//When the chain ends in a vector transform, the vector is carried through each matrix in turn
+//(16 multiplies per matrix) instead of first forming the 4x4 products (64 multiplies each).
+//Assigning the expression to a Matrix evaluates it as an ordinary left-to-right product.
+//
+//Expressions only hold references to their matrices and never allocate, so they must be used
+//within the full-expression that creates them; do not store one in an auto variable.
+
+namespace YAX
+{
+    /**
+    * @brief Base of every lazy matrix expression
+    *
+    * @tparam E The concrete expression type
+    */
+    template <typename E>
+    struct MatrixExpression
+    {
+        /**
+        * @brief Evaluates the expression into a Matrix
+        */
+        operator Matrix() const
+        {
+            return static_cast<const E&>(*this).Evaluate();
+        }
+    };
+
+    /**
+    * @brief A reference to a single matrix, the leaf of every expression
+    */
+    struct MatrixRef : MatrixExpression<MatrixRef>
+    {
+        const Matrix& Mat;
+
+        explicit MatrixRef(const Matrix& mat)
+            : Mat(mat)
+        {}
+
+        Matrix Evaluate() const
+        {
+            return Mat;
+        }
+
+        /**
+        * @brief Multiplies a row vector by the matrix
+        */
+        Vector4 TransformRow(const Vector4& v) const
+        {
+            return Vector4::Transform(v, Mat);
+        }
+    };
+
+    /**
+    * @brief The deferred product of two matrix expressions
+    */
+    template <typename L, typename R>
+    struct MatrixProduct : MatrixExpression<MatrixProduct<L, R>>
+    {
+        L Left;
+        R Right;
+
+        MatrixProduct(const L& left, const R& right)
+            : Left(left), Right(right)
+        {}
+
+        Matrix Evaluate() const
+        {
+            return Left.Evaluate() * Right.Evaluate();
+        }
+
+        /**
+        * @brief Multiplies a row vector by the product, one matrix at a time
+        *
+        * Since v*(L*R) = (v*L)*R, this never forms the product itself.
+        */
+        Vector4 TransformRow(const Vector4& v) const
+        {
+            return Right.TransformRow(Left.TransformRow(v));
+        }
+    };
+
+    /**
+    * @brief Starts a lazy matrix product chain
+    *
+    * @param mat The first matrix of the chain
+    * @return An expression referring to mat
+    */
+    inline MatrixRef Lazy(const Matrix& mat)
+    {
+        return MatrixRef(mat);
+    }
+
+    template <typename L, typename R>
+    MatrixProduct<L, R> operator*(const MatrixExpression<L>& lhs, const MatrixExpression<R>& rhs)
+    {
+        return MatrixProduct<L, R>(static_cast<const L&>(lhs), static_cast<const R&>(rhs));
+    }
+
+    template <typename L>
+    MatrixProduct<L, MatrixRef> operator*(const MatrixExpression<L>& lhs, const Matrix& rhs)
+    {
+        return MatrixProduct<L, MatrixRef>(static_cast<const L&>(lhs), MatrixRef(rhs));
+    }
+
+    template <typename R>
+    MatrixProduct<MatrixRef, R> operator*(const Matrix& lhs, const MatrixExpression<R>& rhs)
+    {
+        return MatrixProduct<MatrixRef, R>(MatrixRef(lhs), static_cast<const R&>(rhs));
+    }
+
+    template <typename E>
+    Vector3 Vector3::Transform(const Vector3& v, const MatrixExpression<E>& mat)
+    {
+        Vector4 res = static_cast<const E&>(mat).TransformRow(Vector4(v, 1.0f));
+        return Vector3(res.X, res.Y, res.Z);
+    }
+
+    template <typename E>
+    Vector4 Vector4::Transform(const Vector4& v, const MatrixExpression<E>& mat)
+    {
+        return static_cast<const E&>(mat).TransformRow(v);
+    }
+}
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef _PACKED_QUATERNION_H
+#define _PACKED_QUATERNION_H
+
+#include "Utils.h"
+
+namespace YAX
+{
+    struct Quaternion;
+
+    /**
+    * @brief A unit quaternion compressed to 32 bits with the smallest-three encoding
+    *
+    * The component with the largest magnitude is dropped and rebuilt from the unit length on decode. Its index takes
+    * 2 bits and the other three components, which always lie in [-1/sqrt(2), 1/sqrt(2)], take 10 bits each. They are
+    * quantized to 1023 evenly spaced values, an odd number so that 0 is exact. Since q and -q are the same rotation, q is
+    * negated first if needed so the dropped component is positive.
+    * The decoded rotation is within 0.005 radians (0.29 degrees) of the original.
+    */
+    struct PackedQuaternion32
+    {
+        ui32 Bits;
+
+        /**
+        * @brief Compresses a quaternion
+        *
+        * @param q The quaternion to compress; must be normalized
+        * @return The packed quaternion
+        */
+        static PackedQuaternion32 Pack(const Quaternion& q);
+
+        /**
+        * @brief Compresses an array of quaternions
+        *
+        * @param source The array of quaternions to compress; must be normalized
+        * @param dest The array to store the packed quaternions in
+        * @param count The number of quaternions to compress
+        */
+        static void Pack(const Quaternion* source, PackedQuaternion32* dest, ui32 count);
+
+        /**
+        * @brief Decompresses the quaternion
+        *
+        * @return The unit quaternion; may be the negation of the one that was packed
+        */
+        Quaternion Unpack() const;
+
+        /**
+        * @brief Decompresses an array of packed quaternions, e.g. while sampling animation keys
+        *
+        * @param source The array of packed quaternions
+        * @param dest The array to store the unit quaternions in
+        * @param count The number of quaternions to decompress
+        */
+        static void Unpack(const PackedQuaternion32* source, Quaternion* dest, ui32 count);
+    };
+
+    /**
+    * @brief A unit quaternion compressed to 48 bits with the smallest-three encoding
+    *
+    * Laid out like PackedQuaternion32, but with 15 bits (32767 values) per component; the index is stored in bits 45
+    * and 46 of the little-endian 48-bit value. The decoded rotation is within 0.00015 radians (0.009 degrees) of the
+    * original.
+    */
+    struct PackedQuaternion48
+    {
+        ui16 Bits[3];
+
+        /**
+        * @brief Compresses a quaternion
+        *
+        * @param q The quaternion to compress; must be normalized
+        * @return The packed quaternion
+        */
+        static PackedQuaternion48 Pack(const Quaternion& q);
+
+        /**
+        * @brief Compresses an array of quaternions
+        *
+        * @param source The array of quaternions to compress; must be normalized
+        * @param dest The array to store the packed quaternions in
+        * @param count The number of quaternions to compress
+        */
+        static void Pack(const Quaternion* source, PackedQuaternion48* dest, ui32 count);
+
+        /**
+        * @brief Decompresses the quaternion
+        *
+        * @return The unit quaternion; may be the negation of the one that was packed
+        */
+        Quaternion Unpack() const;
+
+        /**
+        * @brief Decompresses an array of packed quaternions, e.g. while sampling animation keys
+        *
+        * @param source The array of packed quaternions
+        * @param dest The array to store the unit quaternions in
+        * @param count The number of quaternions to decompress
+        */
+        static void Unpack(const PackedQuaternion48* source, Quaternion* dest, ui32 count);
+    };
+
+    /**
+    * @brief A quaternion compressed to 64 bits, with each component stored as a 16-bit signed normalized integer
+    *
+    * Works for any quaternion with components in [-1, 1], and decoding is a single multiply per component. The decoded
+    * quaternion isn't renormalized; for a unit quaternion, the decoded rotation is within 0.0001 radians (0.006 degrees)
+    * of the original and its length is within 0.00005 of 1.
+    */
+    struct PackedQuaternion64
+    {
+        i16 X, Y, Z, W;
+
+        /**
+        * @brief Compresses a quaternion
+        *
+        * @param q The quaternion to compress; components outside [-1, 1] are clamped
+        * @return The packed quaternion
+        */
+        static PackedQuaternion64 Pack(const Quaternion& q);
+
+        /**
+        * @brief Compresses an array of quaternions
+        *
+        * @param source The array of quaternions to compress; components outside [-1, 1] are clamped
+        * @param dest The array to store the packed quaternions in
+        * @param count The number of quaternions to compress
+        */
+        static void Pack(const Quaternion* source, PackedQuaternion64* dest, ui32 count);
+
+        /**
+        * @brief Decompresses the quaternion
+        *
+        * @return The decompressed quaternion
+        */
+        Quaternion Unpack() const;
+
+        /**
+        * @brief Decompresses an array of packed quaternions, e.g. while sampling animation keys
+        *
+        * @param source The array of packed quaternions
+        * @param dest The array to store the quaternions in
+        * @param count The number of quaternions to decompress
+        */
+        static void Unpack(const PackedQuaternion64* source, Quaternion* dest, ui32 count);
+    };
+}
+
+#ifdef YAX_MATH_INLINE
+#include "PackedQuaternion.inl"
+#endif
+
+#endif
@@ -0,0 +1,362 @@
+#include <algorithm>
+#include <cmath>
+#include "Quaternion.h"
+#include "SIMD.h"
+
+namespace YAX
+{
+    static_assert(sizeof(PackedQuaternion32) == 4, "PackedQuaternion32 must be 4 bytes");
+    static_assert(sizeof(PackedQuaternion48) == 6, "PackedQuaternion48 must be 6 bytes");
+    static_assert(sizeof(PackedQuaternion64) == 8, "PackedQuaternion64 must be 8 bytes");
+
+    namespace Detail
+    {
+        //The smallest three components of a unit quaternion lie in [-SmallestThreeRange, SmallestThreeRange]
+        constexpr float SmallestThreeRange = 0.707106781f;
+
+        //The number of quantization steps across that range. It is even, so 0 lands exactly on the middle code and
+        //the identity and axis-aligned rotations round-trip without a bias
+        constexpr float SmallestThreeSteps32 = 1022.0f;
+        constexpr float SmallestThreeSteps48 = 32766.0f;
+
+        //A smallest-three quaternion split into the index of the dropped component and the three quantized others
+        struct SmallestThree
+        {
+            ui32 Index, A, B, C;
+        };
+
+        YAX_INLINE SmallestThree EncodeSmallestThree(const Quaternion& q, float maxValue)
+        {
+            float c[4] = { q.X, q.Y, q.Z, q.W };
+
+            ui32 index = 0;
+            float largest = std::abs(c[0]);
+            for (ui32 i = 1; i < 4; i++)
+            {
+                if (std::abs(c[i]) > largest)
+                {
+                    index = i;
+                    largest = std::abs(c[i]);
+                }
+            }
+
+            //q and -q are the same rotation, so make the dropped component positive
+            float sign = c[index] < 0.0f ? -1.0f : 1.0f;
+            float scale = maxValue / (2.0f * SmallestThreeRange);
+            float middle = maxValue * 0.5f;
+
+            ui32 quantized[3];
+            for (ui32 i = 0, j = 0; i < 4; i++)
+            {
+                if (i == index)
+                    continue;
+
+                float v = std::min(std::max(c[i] * sign, -SmallestThreeRange), SmallestThreeRange);
+                quantized[j++] = static_cast<ui32>(std::nearbyint(v * scale + middle));
+            }
+
+            return { index, quantized[0], quantized[1], quantized[2] };
+        }
+
+        YAX_INLINE Quaternion DecodeSmallestThree(const SmallestThree& s, float maxValue)
+        {
+            float step = (2.0f * SmallestThreeRange) / maxValue;
+            float middle = maxValue * 0.5f;
+
+            float a = (static_cast<float>(static_cast<i32>(s.A)) - middle) * step;
+            float b = (static_cast<float>(static_cast<i32>(s.B)) - middle) * step;
+            float c = (static_cast<float>(static_cast<i32>(s.C)) - middle) * step;
+            float d = std::sqrt(std::max(0.0f, 1.0f - a*a - b*b - c*c));
+
+            switch (s.Index)
+            {
+            case 0:  return Quaternion(d, a, b, c);
+            case 1:  return Quaternion(a, d, b, c);
+            case 2:  return Quaternion(a, b, d, c);
+            default: return Quaternion(a, b, c, d);
+            }
+        }
+
+        YAX_INLINE ui32 Pack32(const SmallestThree& s)
+        {
+            return s.Index << 30 | s.A << 20 | s.B << 10 | s.C;
+        }
+
+        YAX_INLINE SmallestThree Unpack32(ui32 bits)
+        {
+            return { bits >> 30, (bits >> 20) & 1023, (bits >> 10) & 1023, bits & 1023 };
+        }
+
+        YAX_INLINE PackedQuaternion48 Pack48(const SmallestThree& s)
+        {
+            ui64 bits = static_cast<ui64>(s.Index) << 45 | static_cast<ui64>(s.A) << 30 | static_cast<ui64>(s.B) << 15 | s.C;
+            return { { static_cast<ui16>(bits), static_cast<ui16>(bits >> 16), static_cast<ui16>(bits >> 32) } };
+        }
+
+        YAX_INLINE SmallestThree Unpack48(const PackedQuaternion48& p)
+        {
+            ui64 bits = p.Bits[0] | static_cast<ui64>(p.Bits[1]) << 16 | static_cast<ui64>(p.Bits[2]) << 32;
+            return { static_cast<ui32>(bits >> 45) & 3, static_cast<ui32>(bits >> 30) & 32767,
+                     static_cast<ui32>(bits >> 15) & 32767, static_cast<ui32>(bits) & 32767 };
+        }
+
+#ifdef YAX_SSE
+        YAX_FORCEINLINE __m128 IndexIs(__m128i index, int i)
+        {
+            return _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(i)));
+        }
+
+        //Encodes four quaternions at once with the same operations as EncodeSmallestThree
+        YAX_FORCEINLINE void EncodeSmallestThree(const Quaternion* q, float maxValue, __m128i& index, __m128i& a, __m128i& b, __m128i& c)
+        {
+            __m128 x = _mm_loadu_ps(&q[0].X), y = _mm_loadu_ps(&q[1].X), z = _mm_loadu_ps(&q[2].X), w = _mm_loadu_ps(&q[3].X);
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            const __m128 signMask = _mm_set1_ps(-0.0f);
+            __m128 largest = _mm_andnot_ps(signMask, x);
+            __m128 value = x;
+            index = _mm_setzero_si128();
+
+            const __m128 components[3] = { y, z, w };
+            for (int i = 0; i < 3; i++)
+            {
+                __m128 magnitude = _mm_andnot_ps(signMask, components[i]);
+                __m128 greater = _mm_cmpgt_ps(magnitude, largest);
+
+                index = _mm_castps_si128(SIMD::Select(greater, _mm_castsi128_ps(_mm_set1_epi32(i + 1)), _mm_castsi128_ps(index)));
+                largest = SIMD::Select(greater, magnitude, largest);
+                value = SIMD::Select(greater, components[i], value);
+            }
+
+            __m128 flip = _mm_and_ps(_mm_cmplt_ps(value, _mm_setzero_ps()), signMask);
+            x = _mm_xor_ps(x, flip);
+            y = _mm_xor_ps(y, flip);
+            z = _mm_xor_ps(z, flip);
+            w = _mm_xor_ps(w, flip);
+
+            //The three kept components, in order
+            __m128 fa = SIMD::Select(IndexIs(index, 0), y, x);
+            __m128 fb = SIMD::Select(_mm_or_ps(IndexIs(index, 0), IndexIs(index, 1)), z, y);
+            __m128 fc = SIMD::Select(IndexIs(index, 3), z, w);
+
+            const __m128 range = _mm_set1_ps(SmallestThreeRange);
+            const __m128 negRange = _mm_set1_ps(-SmallestThreeRange);
+            const __m128 scale = _mm_set1_ps(maxValue / (2.0f * SmallestThreeRange));
+            const __m128 middle = _mm_set1_ps(maxValue * 0.5f);
+
+            a = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(fa, negRange), range), scale), middle));
+            b = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(fb, negRange), range), scale), middle));
+            c = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(fc, negRange), range), scale), middle));
+        }
+
+        //Decodes four quaternions at once with the same operations as DecodeSmallestThree
+        YAX_FORCEINLINE void DecodeSmallestThree(__m128i index, __m128i a, __m128i b, __m128i c, float maxValue, Quaternion* q)
+        {
+            const __m128 step = _mm_set1_ps((2.0f * SmallestThreeRange) / maxValue);
+            const __m128 middle = _mm_set1_ps(maxValue * 0.5f);
+
+            __m128 fa = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(a), middle), step);
+            __m128 fb = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(b), middle), step);
+            __m128 fc = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(c), middle), step);
+
+            __m128 d = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(fa, fa)), _mm_mul_ps(fb, fb)), _mm_mul_ps(fc, fc));
+            d = _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), d));
+
+            __m128 is0 = IndexIs(index, 0), is2 = IndexIs(index, 2), is3 = IndexIs(index, 3);
+
+            __m128 x = SIMD::Select(is0, d, fa);
+            __m128 y = SIMD::Select(is0, fa, SIMD::Select(IndexIs(index, 1), d, fb));
+            __m128 z = SIMD::Select(is3, fc, SIMD::Select(is2, d, fb));
+            __m128 w = SIMD::Select(is3, d, fc);
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            _mm_storeu_ps(&q[0].X, x);
+            _mm_storeu_ps(&q[1].X, y);
+            _mm_storeu_ps(&q[2].X, z);
+            _mm_storeu_ps(&q[3].X, w);
+        }
+#endif
+    }
+
+    YAX_INLINE PackedQuaternion32 PackedQuaternion32::Pack(const Quaternion& q)
+    {
+        return { Detail::Pack32(Detail::EncodeSmallestThree(q, Detail::SmallestThreeSteps32)) };
+    }
+
+    YAX_INLINE void PackedQuaternion32::Pack(const Quaternion* source, PackedQuaternion32* dest, ui32 count)
+    {
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i index, a, b, c;
+            Detail::EncodeSmallestThree(source + i, Detail::SmallestThreeSteps32, index, a, b, c);
+
+            __m128i bits = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(index, 30), _mm_slli_epi32(a, 20)),
+                                        _mm_or_si128(_mm_slli_epi32(b, 10), c));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), bits);
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            dest[i] = Pack(source[i]);
+        }
+    }
+
+    YAX_INLINE Quaternion PackedQuaternion32::Unpack() const
+    {
+        return Detail::DecodeSmallestThree(Detail::Unpack32(Bits), Detail::SmallestThreeSteps32);
+    }
+
+    YAX_INLINE void PackedQuaternion32::Unpack(const PackedQuaternion32* source, Quaternion* dest, ui32 count)
+    {
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        const __m128i mask = _mm_set1_epi32(1023);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+
+            Detail::DecodeSmallestThree(_mm_srli_epi32(bits, 30),
+                                        _mm_and_si128(_mm_srli_epi32(bits, 20), mask),
+                                        _mm_and_si128(_mm_srli_epi32(bits, 10), mask),
+                                        _mm_and_si128(bits, mask), Detail::SmallestThreeSteps32, dest + i);
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            dest[i] = source[i].Unpack();
+        }
+    }
+
+    YAX_INLINE PackedQuaternion48 PackedQuaternion48::Pack(const Quaternion& q)
+    {
+        return Detail::Pack48(Detail::EncodeSmallestThree(q, Detail::SmallestThreeSteps48));
+    }
+
+    YAX_INLINE void PackedQuaternion48::Pack(const Quaternion* source, PackedQuaternion48* dest, ui32 count)
+    {
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        //48-bit fields don't line up with SIMD lanes, so only the encoding is vectorized
+        for (; i + 4 <= count; i += 4)
+        {
+            alignas(16) ui32 index[4], a[4], b[4], c[4];
+            __m128i vIndex, vA, vB, vC;
+            Detail::EncodeSmallestThree(source + i, Detail::SmallestThreeSteps48, vIndex, vA, vB, vC);
+
+            _mm_store_si128(reinterpret_cast<__m128i*>(index), vIndex);
+            _mm_store_si128(reinterpret_cast<__m128i*>(a), vA);
+            _mm_store_si128(reinterpret_cast<__m128i*>(b), vB);
+            _mm_store_si128(reinterpret_cast<__m128i*>(c), vC);
+
+            for (ui32 j = 0; j < 4; j++)
+            {
+                dest[i + j] = Detail::Pack48({ index[j], a[j], b[j], c[j] });
+            }
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            dest[i] = Pack(source[i]);
+        }
+    }
+
+    YAX_INLINE Quaternion PackedQuaternion48::Unpack() const
+    {
+        return Detail::DecodeSmallestThree(Detail::Unpack48(*this), Detail::SmallestThreeSteps48);
+    }
+
+    YAX_INLINE void PackedQuaternion48::Unpack(const PackedQuaternion48* source, Quaternion* dest, ui32 count)
+    {
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        //48-bit fields don't line up with SIMD lanes, so only the decoding is vectorized
+        for (; i + 4 <= count; i += 4)
+        {
+            Detail::SmallestThree s[4] = { Detail::Unpack48(source[i]), Detail::Unpack48(source[i + 1]),
+                                           Detail::Unpack48(source[i + 2]), Detail::Unpack48(source[i + 3]) };
+
+            Detail::DecodeSmallestThree(_mm_setr_epi32(s[0].Index, s[1].Index, s[2].Index, s[3].Index),
+                                        _mm_setr_epi32(s[0].A, s[1].A, s[2].A, s[3].A),
+                                        _mm_setr_epi32(s[0].B, s[1].B, s[2].B, s[3].B),
+                                        _mm_setr_epi32(s[0].C, s[1].C, s[2].C, s[3].C), Detail::SmallestThreeSteps48, dest + i);
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            dest[i] = source[i].Unpack();
+        }
+    }
+
+    YAX_INLINE PackedQuaternion64 PackedQuaternion64::Pack(const Quaternion& q)
+    {
+        auto pack = [](float v) { return static_cast<i16>(std::nearbyint(std::min(std::max(v, -1.0f), 1.0f) * 32767.0f)); };
+        return { pack(q.X), pack(q.Y), pack(q.Z), pack(q.W) };
+    }
+
+    YAX_INLINE void PackedQuaternion64::Pack(const Quaternion* source, PackedQuaternion64* dest, ui32 count)
+    {
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 negOne = _mm_set1_ps(-1.0f);
+        const __m128 scale = _mm_set1_ps(32767.0f);
+
+        //Each register already holds one whole quaternion, so no transpose is needed
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128i q0 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(&source[i].X), negOne), one), scale));
+            __m128i q1 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(&source[i + 1].X), negOne), one), scale));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_packs_epi32(q0, q1));
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            dest[i] = Pack(source[i]);
+        }
+    }
+
+    YAX_INLINE Quaternion PackedQuaternion64::Unpack() const
+    {
+        const float scale = 1.0f / 32767.0f;
+        return Quaternion(X * scale, Y * scale, Z * scale, W * scale);
+    }
+
+    YAX_INLINE void PackedQuaternion64::Unpack(const PackedQuaternion64* source, Quaternion* dest, ui32 count)
+    {
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        const __m128 scale = _mm_set1_ps(1.0f / 32767.0f);
+
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+
+            //Sign-extends each 16-bit component by moving it to the top of a 32-bit lane and shifting it back down
+            __m128i q0 = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+            __m128i q1 = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+
+            _mm_storeu_ps(&dest[i].X, _mm_mul_ps(_mm_cvtepi32_ps(q0), scale));
+            _mm_storeu_ps(&dest[i + 1].X, _mm_mul_ps(_mm_cvtepi32_ps(q1), scale));
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            dest[i] = source[i].Unpack();
+        }
+    }
+}
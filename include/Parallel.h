@@ -0,0 +1,81 @@
+#ifndef _PARALLEL_H
+#define _PARALLEL_H
+
+#include <functional>
+#include "Utils.h"
+
+namespace YAX
+{
+    /**
+    * @brief Selects how a batch function spreads its work, mirroring the std::execution policies
+    */
+    enum class ExecutionPolicy
+    {
+        Sequential,             //Runs on the calling thread
+        Parallel,               //Splits the work across the thread pool
+        ParallelUnsequenced     //Same as Parallel; the kernels within each block are already vectorized
+    };
+
+    //A work-stealing thread pool shared by every batch function that takes an ExecutionPolicy.
+    //The workers are started on first use. Each call splits its range into blocks, deals the blocks out
+    //evenly between the calling thread and the workers, and lets threads that run out steal blocks from the others.
+    namespace Parallel
+    {
+        /**
+        * @brief The number of bytes of input and output a block is sized to, chosen to fit in a core's L1 and L2 caches
+        */
+        constexpr ui32 BlockBytes = 32 * 1024;
+
+        /**
+        * @brief Sets the number of threads that run parallel work, including the calling thread
+        *
+        * Waits for any running work to finish before resizing the pool. Throws std::logic_error if called from
+        * inside a parallel body, which would otherwise wait for itself.
+        *
+        * @param count The number of threads; 0 to use one per hardware thread
+        */
+        void SetThreadCount(ui32 count);
+
+        /**
+        * @brief Gets the number of threads that run parallel work, including the calling thread
+        */
+        ui32 GetThreadCount();
+
+        /**
+        * @brief Finds how many elements fit in a cache-sized block
+        *
+        * The result is rounded down to a multiple of 8 when possible, so SIMD kernels don't leave a scalar tail in every block.
+        *
+        * @param elementBytes The number of bytes read and written per element
+        * @return The number of elements per block; at least 1
+        */
+        constexpr ui32 BlockSize(ui32 elementBytes)
+        {
+            return elementBytes == 0 ? BlockBytes
+                 : BlockBytes / elementBytes >= 8 ? BlockBytes / elementBytes / 8 * 8
+                 : BlockBytes / elementBytes == 0 ? 1
+                 : BlockBytes / elementBytes;
+        }
+
+        /**
+        * @brief Calls body over consecutive sub-ranges covering [0, count)
+        *
+        * With ExecutionPolicy::Sequential, or when called from inside a parallel body, body is called once
+        * for the whole range on the calling thread. Otherwise the sub-ranges may run concurrently on any
+        * thread of the pool, and the call returns once all of them have finished. If body throws, the sub-ranges
+        * that haven't started are skipped, and the first exception is rethrown once the running ones have finished.
+        *
+        * @param policy How to run the work
+        * @param count The number of elements
+        * @param blockSize The number of elements per sub-range
+        * @param body Called with the [begin, end) of each sub-range
+        */
+        void For(ExecutionPolicy policy, ui32 count, ui32 blockSize, const std::function<void(ui32 begin, ui32 end)>& body);
+    }
+}
+
+#ifdef YAX_MATH_INLINE
+#include "Parallel.inl"
+#endif
+
+#endif
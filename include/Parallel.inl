@@ -0,0 +1,293 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace YAX
+{
+    namespace Detail
+    {
+        //Blocks [Next, End) still waiting to run. The owning thread takes from the front, thieves from the back.
+        struct BlockQueue
+        {
+            std::mutex Lock;
+            ui32 Next = 0;
+            ui32 End = 0;
+        };
+
+        class ThreadPool
+        {
+        public:
+            ThreadPool()
+                : threadCount(DefaultThreadCount()), generation(0), stopping(false), body(nullptr),
+                  blockSize(0), count(0), busyWorkers(0)
+            {}
+
+            ~ThreadPool()
+            {
+                Stop();
+            }
+
+            void SetThreadCount(ui32 n)
+            {
+                //The calling thread's own range holds submitLock, or waits for this thread to finish
+                if (InsideParallelBody())
+                    throw std::logic_error("Parallel::SetThreadCount can't be called from inside a parallel body");
+
+                std::lock_guard<std::mutex> submit(submitLock);
+                Stop();
+                threadCount = n == 0 ? DefaultThreadCount() : n;
+            }
+
+            ui32 GetThreadCount() const
+            {
+                return threadCount;
+            }
+
+            void Run(ui32 elementCount, ui32 elementsPerBlock, const std::function<void(ui32, ui32)>& fn)
+            {
+                //Only one range runs at a time; the pool is sized to use every core on its own
+                std::lock_guard<std::mutex> submit(submitLock);
+
+                if (workers.size() + 1 != threadCount)
+                    Start();
+
+                ui32 blockCount = static_cast<ui32>((static_cast<ui64>(elementCount) + elementsPerBlock - 1) / elementsPerBlock);
+
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+
+                    for (ui32 t = 0; t < threadCount; t++)
+                    {
+                        queues[t].Next = static_cast<ui32>(static_cast<ui64>(blockCount) * t / threadCount);
+                        queues[t].End = static_cast<ui32>(static_cast<ui64>(blockCount) * (t + 1) / threadCount);
+                    }
+
+                    body = &fn;
+                    blockSize = elementsPerBlock;
+                    count = elementCount;
+                    busyWorkers = threadCount - 1;
+                    generation++;
+                }
+
+                wake.notify_all();
+                Work(0);
+
+                std::unique_lock<std::mutex> guard(lock);
+                done.wait(guard, [this] { return busyWorkers == 0; });
+                body = nullptr;
+
+                //Every thread is done with fn by now, so the first exception can be passed on to the caller
+                std::exception_ptr failure = error;
+                error = nullptr;
+
+                if (failure)
+                    std::rethrow_exception(failure);
+            }
+
+            //Set while a thread runs parallel work, so nested calls run sequentially instead of waiting on the pool
+            static bool& InsideParallelBody()
+            {
+                thread_local bool inside = false;
+                return inside;
+            }
+
+        private:
+            static ui32 DefaultThreadCount()
+            {
+                ui32 n = std::thread::hardware_concurrency();
+                return n == 0 ? 1 : n;
+            }
+
+            void Start()
+            {
+                Stop();
+
+                queues.reset(new BlockQueue[threadCount]);
+
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    stopping = false;
+                }
+
+                for (ui32 t = 1; t < threadCount; t++)
+                {
+                    workers.emplace_back(&ThreadPool::WorkerLoop, this, t, generation);
+                }
+            }
+
+            void Stop()
+            {
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    stopping = true;
+                }
+
+                wake.notify_all();
+
+                for (std::thread& worker : workers)
+                {
+                    worker.join();
+                }
+
+                workers.clear();
+            }
+
+            void WorkerLoop(ui32 index, ui64 seen)
+            {
+                for (;;)
+                {
+                    {
+                        std::unique_lock<std::mutex> guard(lock);
+                        wake.wait(guard, [&] { return stopping || generation != seen; });
+
+                        if (stopping)
+                            return;
+
+                        seen = generation;
+                    }
+
+                    Work(index);
+
+                    std::lock_guard<std::mutex> guard(lock);
+                    if (--busyWorkers == 0)
+                        done.notify_one();
+                }
+            }
+
+            bool TakeBlock(ui32 index, ui32& block)
+            {
+                {
+                    BlockQueue& own = queues[index];
+                    std::lock_guard<std::mutex> guard(own.Lock);
+
+                    if (own.Next < own.End)
+                    {
+                        block = own.Next++;
+                        return true;
+                    }
+                }
+
+                //Out of work, so steal from the back of the other threads' queues
+                for (ui32 i = 1; i < threadCount; i++)
+                {
+                    BlockQueue& victim = queues[(index + i) % threadCount];
+                    std::lock_guard<std::mutex> guard(victim.Lock);
+
+                    if (victim.Next < victim.End)
+                    {
+                        block = --victim.End;
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            //Keeps the first exception thrown by the body and drops the blocks nobody has taken yet
+            void Fail(std::exception_ptr e)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    if (!error)
+                        error = e;
+                }
+
+                for (ui32 t = 0; t < threadCount; t++)
+                {
+                    std::lock_guard<std::mutex> guard(queues[t].Lock);
+                    queues[t].End = queues[t].Next;
+                }
+            }
+
+            void Work(ui32 index)
+            {
+                bool& inside = InsideParallelBody();
+                inside = true;
+
+                ui32 block;
+                while (TakeBlock(index, block))
+                {
+                    ui64 begin = static_cast<ui64>(block) * blockSize;
+
+                    //An exception can't be left to escape: the calling thread would unwind while the workers still
+                    //use the body, and a worker thread would terminate the program
+                    try
+                    {
+                        (*body)(static_cast<ui32>(begin), static_cast<ui32>(std::min<ui64>(count, begin + blockSize)));
+                    }
+                    catch (...)
+                    {
+                        Fail(std::current_exception());
+                    }
+                }
+
+                inside = false;
+            }
+
+            std::mutex submitLock;
+            std::mutex lock;
+            std::condition_variable wake;
+            std::condition_variable done;
+
+            std::vector<std::thread> workers;
+            std::unique_ptr<BlockQueue[]> queues;
+            std::atomic<ui32> threadCount;      //Atomic so GetThreadCount works without submitLock, even from inside a body
+            ui64 generation;
+            bool stopping;
+
+            //The current range, written under lock before generation is bumped
+            const std::function<void(ui32, ui32)>* body;
+            ui32 blockSize;
+            ui32 count;
+            ui32 busyWorkers;
+            std::exception_ptr error;
+        };
+
+        YAX_INLINE ThreadPool& Pool()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+    }
+
+    YAX_INLINE void Parallel::SetThreadCount(ui32 count)
+    {
+        Detail::Pool().SetThreadCount(count);
+    }
+
+    YAX_INLINE ui32 Parallel::GetThreadCount()
+    {
+        return Detail::Pool().GetThreadCount();
+    }
+
+    YAX_INLINE void Parallel::For(ExecutionPolicy policy, ui32 count, ui32 blockSize, const std::function<void(ui32 begin, ui32 end)>& body)
+    {
+        if (count == 0)
+            return;
+
+        if (blockSize == 0)
+            blockSize = 1;
+
+        if (policy == ExecutionPolicy::Sequential || count <= blockSize || Detail::ThreadPool::InsideParallelBody())
+        {
+            body(0, count);
+            return;
+        }
+
+        Detail::ThreadPool& pool = Detail::Pool();
+
+        if (pool.GetThreadCount() == 1)
+        {
+            body(0, count);
+            return;
+        }
+
+        pool.Run(count, blockSize, body);
+    }
+}
@@ -1,6 +1,8 @@
 #ifndef _QUATERNION_H
 #define _QUATERNION_H
 
+#include "Utils.h"
+
 namespace YAX
 {
     struct Vector3;
@@ -20,7 +22,7 @@ namespace YAX
         * @param z The z vector component; z = rotationAxis_z * sin(rotationAngle / 2)
         * @param w The real component; w = cos(rotationAngle / 2)
         */
-        Quaternion(float x, float y, float z, float w);
+        constexpr Quaternion(float x, float y, float z, float w);
 
         /**
         * @brief Creates a quaternion from precalculated components
@@ -28,7 +30,7 @@ namespace YAX
         * @param xyz The vector component of the quaternion; xyz = roationAxis * sin(rotationAngle / 2)
         * @param w The real component of the quaternion; w = cos(rotationAngle / 2)
         */
-        Quaternion(const Vector3& xyz, float w);
+        constexpr Quaternion(const Vector3& xyz, float w);
 
         /**
         * @brief Find the conjugate of the quaternion in-place
@@ -91,11 +93,26 @@ namespace YAX
         /**
         * @brief Converts a rotation matrix into its equivalent quaternion representation
         *
-        * @param mat The rotation matrix to convert
+        * Uses Shepperd's method: the quaternion is built around whichever of w, x, y or z has the largest magnitude,
+        * so it never divides by a value near zero.
+        *
+        * @param mat The rotation matrix to convert; must not contain scale or shear
         * @return The quaternion representing the rotation 
         */
         static Quaternion CreateFromRotationMatrix(const Matrix& mat);
 
+        /**
+        * @brief Converts an array of rotation matrices into quaternions
+        *
+        * Four matrices are converted at a time, with the branch of each chosen per SIMD lane instead of by jumping.
+        * The results are the same as CreateFromRotationMatrix.
+        *
+        * @param source The array of rotation matrices to convert; must not contain scale or shear
+        * @param dest The array to store the quaternions in
+        * @param count The number of matrices to convert
+        */
+        static void CreateFromRotationMatrix(const Matrix* source, Quaternion* dest, ui32 count);
+
         /**
         * @brief Creates a quaternion from yaw (Y), pitch (X), and roll (Z), angles
         *
@@ -144,12 +161,50 @@ namespace YAX
         /**
         * @brief Performs a spherical linear interpolation between two quaternions 
         *
-        * @param from The start (t = 0) quaternion
-        * @param to The end (t = 1) quaternion
+        * Interpolates along the shorter arc, so the result may be the negation of to at t = 1; both represent the same rotation.
+        *
+        * @param from The start (t = 0) quaternion; must be normalized
+        * @param to The end (t = 1) quaternion; must be normalized
         * @param t The interpolation weight
+        * @return The interpolated quaternion
         */
         static Quaternion Slerp(const Quaternion& from, const Quaternion& to, float t);
 
+        /**
+        * @brief Performs spherical linear interpolation over arrays of keyframe pairs
+        *
+        * @param from The array of start (t = 0) quaternions; must be normalized
+        * @param to The array of end (t = 1) quaternions; must be normalized
+        * @param t The array of interpolation weights
+        * @param dest The array to store the interpolated quaternions in; may be the same array as from or to
+        * @param count The number of quaternions to interpolate
+        */
+        static void Slerp(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* dest, ui32 count);
+
+        /**
+        * @brief Approximates Slerp with a normalized Lerp whose weight is corrected by a polynomial
+        *
+        * Avoids the trigonometric functions of Slerp. For t in [0, 1], the result is within 0.001 radians
+        * of the rotation Slerp would give, compared to 0.14 radians for a plain normalized Lerp.
+        *
+        * @param from The start (t = 0) quaternion; must be normalized
+        * @param to The end (t = 1) quaternion; must be normalized
+        * @param t The interpolation weight, between 0 and 1
+        * @return The interpolated quaternion
+        */
+        static Quaternion SlerpFast(const Quaternion& from, const Quaternion& to, float t);
+
+        /**
+        * @brief Approximates Slerp over arrays of keyframe pairs; see SlerpFast
+        *
+        * @param from The array of start (t = 0) quaternions; must be normalized
+        * @param to The array of end (t = 1) quaternions; must be normalized
+        * @param t The array of interpolation weights, between 0 and 1
+        * @param dest The array to store the interpolated quaternions in; may be the same array as from or to
+        * @param count The number of quaternions to interpolate
+        */
+        static void SlerpFast(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* dest, ui32 count);
+
         Quaternion& operator+=(const Quaternion&);
         Quaternion& operator-=(const Quaternion&);
         Quaternion& operator*=(const Quaternion&);
@@ -172,5 +227,24 @@ namespace YAX
     bool operator!=(const Quaternion&, const Quaternion&);
 }
 
+//Included after the declarations above so that the headers can depend on each other
+#include "Vector3.h"
+
+namespace YAX
+{
+    constexpr Quaternion::Quaternion(float x, float y, float z, float w)
+        : X(x), Y(y), Z(z), W(w)
+    {}
+
+    constexpr Quaternion::Quaternion(const Vector3& xyz, float w)
+        : Quaternion(xyz.X, xyz.Y, xyz.Z, w)
+    {}
+
+    constexpr Quaternion Quaternion::Identity = Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+#ifdef YAX_MATH_INLINE
+#include "Quaternion.inl"
+#endif
 
-#endif
\ No newline at end of file
+#endif
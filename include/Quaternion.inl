@@ -0,0 +1,490 @@
+#include <cmath>
+#include "MathHelper.h"
+#include "Matrix.h"
+#include "SIMD.h"
+#include "Vector3.h"
+
+namespace YAX
+{
+    static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion must be 4 tightly packed floats");
+
+    YAX_INLINE void Quaternion::Conjugate()
+    {
+#ifdef YAX_SSE
+        _mm_storeu_ps(&X, _mm_xor_ps(_mm_loadu_ps(&X), _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f)));
+#else
+        X = -X;
+        Y = -Y;
+        Z = -Z;
+#endif
+    }
+
+    YAX_INLINE float Quaternion::Dot(const Quaternion& q) const
+    {
+#ifdef YAX_SSE
+        return _mm_cvtss_f32(SIMD::Dot4(_mm_loadu_ps(&X), _mm_loadu_ps(&q.X)));
+#else
+        return X*q.X + Y*q.Y + Z*q.Z + W*q.W;
+#endif
+    }
+
+    YAX_INLINE float Quaternion::Length() const
+    {
+        return std::sqrt(LengthSquared());
+    }
+
+    YAX_INLINE float Quaternion::LengthSquared() const
+    {
+        return Dot(*this);
+    }
+
+    YAX_INLINE void Quaternion::Normalize()
+    {
+#ifdef YAX_SSE
+        __m128 q = _mm_loadu_ps(&X);
+        _mm_storeu_ps(&X, _mm_div_ps(q, _mm_sqrt_ps(SIMD::Dot4(q, q))));
+#else
+        float len = Length();
+        X /= len;
+        Y /= len;
+        Z /= len;
+        W /= len;
+#endif
+    }
+
+    YAX_INLINE Quaternion Quaternion::Concatenate(const Quaternion& f, const Quaternion& s)
+    {
+        return s*f;
+    }
+
+    YAX_INLINE Quaternion Quaternion::Conjugate(Quaternion q)
+    {
+        q.Conjugate();
+        return q;
+    }
+
+    YAX_INLINE Quaternion Quaternion::CreateFromAxisAngle(const Vector3& axis, float angle)
+    {
+        float s = std::sin(angle / 2);
+        return Quaternion(axis*s, std::cos(angle / 2));
+    }
+
+    YAX_INLINE Quaternion Quaternion::CreateFromRotationMatrix(const Matrix& m)
+    {
+        //4w^2, 4x^2, 4y^2 and 4z^2; the largest is at least 1, so its square root is safe to divide by
+        float tw = 1 + m.M11 + m.M22 + m.M33;
+        float tx = 1 + m.M11 - m.M22 - m.M33;
+        float ty = 1 - m.M11 + m.M22 - m.M33;
+        float tz = 1 - m.M11 - m.M22 + m.M33;
+
+        Quaternion q(m.M23 - m.M32, m.M31 - m.M13, m.M12 - m.M21, tw);
+        float largest = tw;
+
+        if (tx > largest)
+        {
+            q = Quaternion(tx, m.M12 + m.M21, m.M13 + m.M31, m.M23 - m.M32);
+            largest = tx;
+        }
+
+        if (ty > largest)
+        {
+            q = Quaternion(m.M12 + m.M21, ty, m.M23 + m.M32, m.M31 - m.M13);
+            largest = ty;
+        }
+
+        if (tz > largest)
+        {
+            q = Quaternion(m.M13 + m.M31, m.M23 + m.M32, tz, m.M12 - m.M21);
+            largest = tz;
+        }
+
+        float scale = 0.5f / std::sqrt(largest);
+        return Quaternion(q.X * scale, q.Y * scale, q.Z * scale, q.W * scale);
+    }
+
+    YAX_INLINE void Quaternion::CreateFromRotationMatrix(const Matrix* source, Quaternion* dest, ui32 count)
+    {
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        for (; i + 4 <= count; i += 4)
+        {
+            //Transposed so each register holds one element of all four matrices
+            __m128 m11 = _mm_loadu_ps(&source[i].M11), m12 = _mm_loadu_ps(&source[i + 1].M11),
+                   m13 = _mm_loadu_ps(&source[i + 2].M11), r1 = _mm_loadu_ps(&source[i + 3].M11);
+            __m128 m21 = _mm_loadu_ps(&source[i].M21), m22 = _mm_loadu_ps(&source[i + 1].M21),
+                   m23 = _mm_loadu_ps(&source[i + 2].M21), r2 = _mm_loadu_ps(&source[i + 3].M21);
+            __m128 m31 = _mm_loadu_ps(&source[i].M31), m32 = _mm_loadu_ps(&source[i + 1].M31),
+                   m33 = _mm_loadu_ps(&source[i + 2].M31), r3 = _mm_loadu_ps(&source[i + 3].M31);
+            _MM_TRANSPOSE4_PS(m11, m12, m13, r1);
+            _MM_TRANSPOSE4_PS(m21, m22, m23, r2);
+            _MM_TRANSPOSE4_PS(m31, m32, m33, r3);
+
+            //Same operations in the same order as the scalar version, with each branch chosen per lane
+            const __m128 one = _mm_set1_ps(1.0f);
+            __m128 tw = _mm_add_ps(_mm_add_ps(_mm_add_ps(one, m11), m22), m33);
+            __m128 tx = _mm_sub_ps(_mm_sub_ps(_mm_add_ps(one, m11), m22), m33);
+            __m128 ty = _mm_sub_ps(_mm_add_ps(_mm_sub_ps(one, m11), m22), m33);
+            __m128 tz = _mm_add_ps(_mm_sub_ps(_mm_sub_ps(one, m11), m22), m33);
+
+            __m128 s12 = _mm_add_ps(m12, m21), s13 = _mm_add_ps(m13, m31), s23 = _mm_add_ps(m23, m32);
+            __m128 d23 = _mm_sub_ps(m23, m32), d31 = _mm_sub_ps(m31, m13), d12 = _mm_sub_ps(m12, m21);
+
+            __m128 x = d23, y = d31, z = d12, w = tw;
+            __m128 largest = tw;
+
+            __m128 mask = _mm_cmpgt_ps(tx, largest);
+            x = SIMD::Select(mask, tx, x);
+            y = SIMD::Select(mask, s12, y);
+            z = SIMD::Select(mask, s13, z);
+            w = SIMD::Select(mask, d23, w);
+            largest = SIMD::Select(mask, tx, largest);
+
+            mask = _mm_cmpgt_ps(ty, largest);
+            x = SIMD::Select(mask, s12, x);
+            y = SIMD::Select(mask, ty, y);
+            z = SIMD::Select(mask, s23, z);
+            w = SIMD::Select(mask, d31, w);
+            largest = SIMD::Select(mask, ty, largest);
+
+            mask = _mm_cmpgt_ps(tz, largest);
+            x = SIMD::Select(mask, s13, x);
+            y = SIMD::Select(mask, s23, y);
+            z = SIMD::Select(mask, tz, z);
+            w = SIMD::Select(mask, d12, w);
+            largest = SIMD::Select(mask, tz, largest);
+
+            __m128 scale = _mm_div_ps(_mm_set1_ps(0.5f), _mm_sqrt_ps(largest));
+            x = _mm_mul_ps(x, scale);
+            y = _mm_mul_ps(y, scale);
+            z = _mm_mul_ps(z, scale);
+            w = _mm_mul_ps(w, scale);
+
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            _mm_storeu_ps(&dest[i].X, x);
+            _mm_storeu_ps(&dest[i + 1].X, y);
+            _mm_storeu_ps(&dest[i + 2].X, z);
+            _mm_storeu_ps(&dest[i + 3].X, w);
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            dest[i] = CreateFromRotationMatrix(source[i]);
+        }
+    }
+
+    YAX_INLINE Quaternion Quaternion::CreateFromYawPitchRoll(float y, float p, float r)
+    {
+        Quaternion pitch = Quaternion::CreateFromAxisAngle(Vector3::Right, p);
+        Quaternion yaw = Quaternion::CreateFromAxisAngle(Vector3::Up, y);
+        Quaternion roll = Quaternion::CreateFromAxisAngle(Vector3::Backward, r);
+
+        return yaw*pitch*roll;
+    }
+
+    YAX_INLINE float Quaternion::Dot(const Quaternion& q1, const Quaternion& q2)
+    {
+        return q1.Dot(q2);
+    }
+
+    YAX_INLINE Quaternion Quaternion::Inverse(Quaternion q)
+    {
+        q.Conjugate();
+        q /= q.LengthSquared();
+        return q;
+    }
+
+    YAX_INLINE Quaternion Quaternion::Lerp(const Quaternion& from, const Quaternion& to, float t)
+    {
+        return Quaternion(MathHelper::Lerp(from.X, to.X, t),
+                          MathHelper::Lerp(from.Y, to.Y, t),
+                          MathHelper::Lerp(from.Z, to.Z, t),
+                          MathHelper::Lerp(from.W, to.W, t));
+    }
+
+    YAX_INLINE Quaternion Quaternion::Normalize(Quaternion q)
+    {
+        q.Normalize();
+        return q;
+    }
+
+#pragma region SLERP Operations
+    namespace Detail
+    {
+        //Kapoulkine's correction of the nlerp weight, fitted so the result tracks slerp; d is |dot(from, to)|
+        YAX_INLINE float SlerpFastWeight(float d, float t)
+        {
+            float a = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+            float b = 0.848013f + d * (-1.06021f + d * 0.215638f);
+            float k = a * (t - 0.5f) * (t - 0.5f) + b;
+            return t + t * (t - 0.5f) * (t - 1.0f) * k;
+        }
+    }
+
+    YAX_INLINE Quaternion Quaternion::Slerp(const Quaternion& from, const Quaternion& to, float t)
+    {
+        float d = Quaternion::Dot(from, to);
+        float sign = 1.0f;
+
+        //q and -q are the same rotation, so flip to onto the shorter arc
+        if (d < 0.0f)
+        {
+            d = -d;
+            sign = -1.0f;
+        }
+
+        //If the quaternions are very close, sin(theta) is too small to divide by, so use a normalized Lerp instead
+        if (d > 0.9995f)
+            return Quaternion::Normalize(from*(1.0f - t) + to*(t*sign));
+
+        float theta = std::acos(d);
+        float invSin = 1.0f / std::sin(theta);
+
+        return from*(std::sin((1.0f - t)*theta)*invSin) + to*(std::sin(t*theta)*invSin*sign);
+    }
+
+    YAX_INLINE void Quaternion::Slerp(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* dest, ui32 count)
+    {
+        for (ui32 i = 0; i < count; i++)
+        {
+            dest[i] = Slerp(from[i], to[i], t[i]);
+        }
+    }
+
+    YAX_INLINE Quaternion Quaternion::SlerpFast(const Quaternion& from, const Quaternion& to, float t)
+    {
+        float d = Quaternion::Dot(from, to);
+        float w = Detail::SlerpFastWeight(std::abs(d), t);
+
+        return Quaternion::Normalize(from*(1.0f - w) + to*(d < 0.0f ? -w : w));
+    }
+
+    YAX_INLINE void Quaternion::SlerpFast(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* dest, ui32 count)
+    {
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        //Four pairs at a time, transposed so each register holds one component of four quaternions
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 fx = _mm_loadu_ps(&from[i].X), fy = _mm_loadu_ps(&from[i + 1].X),
+                   fz = _mm_loadu_ps(&from[i + 2].X), fw = _mm_loadu_ps(&from[i + 3].X);
+            __m128 tx = _mm_loadu_ps(&to[i].X), ty = _mm_loadu_ps(&to[i + 1].X),
+                   tz = _mm_loadu_ps(&to[i + 2].X), tw = _mm_loadu_ps(&to[i + 3].X);
+            _MM_TRANSPOSE4_PS(fx, fy, fz, fw);
+            _MM_TRANSPOSE4_PS(tx, ty, tz, tw);
+
+            __m128 tt = _mm_loadu_ps(t + i);
+
+            __m128 dot = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(fx, tx), _mm_mul_ps(fy, ty)), _mm_mul_ps(fz, tz)), _mm_mul_ps(fw, tw));
+            __m128 d = _mm_andnot_ps(signMask, dot);
+
+            //Same operations in the same order as Detail::SlerpFastWeight, so the results match the scalar path
+            __m128 a = _mm_add_ps(_mm_set1_ps(1.0904f), _mm_mul_ps(d, _mm_add_ps(_mm_set1_ps(-3.2452f),
+                       _mm_mul_ps(d, _mm_sub_ps(_mm_set1_ps(3.55645f), _mm_mul_ps(d, _mm_set1_ps(1.43519f)))))));
+            __m128 b = _mm_add_ps(_mm_set1_ps(0.848013f), _mm_mul_ps(d, _mm_add_ps(_mm_set1_ps(-1.06021f),
+                       _mm_mul_ps(d, _mm_set1_ps(0.215638f)))));
+            __m128 th = _mm_sub_ps(tt, half);
+            __m128 k = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(a, th), th), b);
+            __m128 w = _mm_add_ps(tt, _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(tt, th), _mm_sub_ps(tt, one)), k));
+
+            __m128 wf = _mm_sub_ps(one, w);
+            __m128 wt = _mm_xor_ps(w, _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), signMask));
+
+            __m128 x = _mm_add_ps(_mm_mul_ps(fx, wf), _mm_mul_ps(tx, wt));
+            __m128 y = _mm_add_ps(_mm_mul_ps(fy, wf), _mm_mul_ps(ty, wt));
+            __m128 z = _mm_add_ps(_mm_mul_ps(fz, wf), _mm_mul_ps(tz, wt));
+            __m128 q = _mm_add_ps(_mm_mul_ps(fw, wf), _mm_mul_ps(tw, wt));
+
+            __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(q, q)));
+            x = _mm_div_ps(x, len);
+            y = _mm_div_ps(y, len);
+            z = _mm_div_ps(z, len);
+            q = _mm_div_ps(q, len);
+
+            _MM_TRANSPOSE4_PS(x, y, z, q);
+            _mm_storeu_ps(&dest[i].X, x);
+            _mm_storeu_ps(&dest[i + 1].X, y);
+            _mm_storeu_ps(&dest[i + 2].X, z);
+            _mm_storeu_ps(&dest[i + 3].X, q);
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            dest[i] = SlerpFast(from[i], to[i], t[i]);
+        }
+    }
+#pragma endregion
+
+    YAX_INLINE Quaternion& Quaternion::operator+=(const Quaternion& q)
+    {
+#ifdef YAX_SSE
+        _mm_storeu_ps(&X, _mm_add_ps(_mm_loadu_ps(&X), _mm_loadu_ps(&q.X)));
+        return *this;
+#else
+        this->X += q.X;
+        this->Y += q.Y;
+        this->Z += q.Z; 
+        this->W += q.W;
+        return *this;
+#endif
+    }
+
+    YAX_INLINE Quaternion& Quaternion::operator-=(const Quaternion& q)
+    {
+#ifdef YAX_SSE
+        _mm_storeu_ps(&X, _mm_sub_ps(_mm_loadu_ps(&X), _mm_loadu_ps(&q.X)));
+        return *this;
+#else
+        this->X -= q.X;
+        this->Y -= q.Y;
+        this->Z -= q.Z;
+        this->W -= q.W;
+        return *this;
+#endif
+    }
+
+    YAX_INLINE Quaternion& Quaternion::operator*=(const Quaternion& q)
+    {
+#ifdef YAX_SSE
+        _mm_storeu_ps(&X, SIMD::QuaternionMultiply(_mm_loadu_ps(&X), _mm_loadu_ps(&q.X)));
+        return *this;
+#else
+        float x = W*q.X + X*q.W + Y*q.Z - Z*q.Y;
+        float y = W*q.Y - X*q.Z + Y*q.W + Z*q.X;
+        float z = W*q.Z + X*q.Y - Y*q.X + Z*q.W;
+        float w = W*q.W - X*q.X - Y*q.Y - Z*q.Z;
+        
+        X = x;
+        Y = y;
+        Z = z;
+        W = w;
+        
+        return *this;
+#endif
+    }
+
+    YAX_INLINE Quaternion& Quaternion::operator*=(float f)
+    {
+#ifdef YAX_SSE
+        _mm_storeu_ps(&X, _mm_mul_ps(_mm_loadu_ps(&X), _mm_set1_ps(f)));
+        return *this;
+#else
+        this->X *= f;
+        this->Y *= f;
+        this->Z *= f;
+        this->W *= f;
+        return *this;
+#endif
+    }
+
+    YAX_INLINE Quaternion& Quaternion::operator/=(const Quaternion& q)
+    {
+#ifdef YAX_SSE
+        __m128 b = _mm_loadu_ps(&q.X);
+        _mm_storeu_ps(&X, _mm_div_ps(SIMD::QuaternionMultiplyConjugate(_mm_loadu_ps(&X), b), SIMD::Dot4(b, b)));
+        return *this;
+#else
+        float len = q.LengthSquared();
+
+        float x = q.W*X - q.X*W - q.Y*Z + q.Z*Y;
+        float y = q.W*Y + q.X*Z - q.Y*W - q.Z*X;
+        float z = q.W*Z - q.X*Y + q.Y*X - q.Z*W;
+        float w = W*q.W + X*q.X + Y*q.Y + Z*q.Z;
+
+        X = x / len;
+        Y = y / len;
+        Z = z / len;
+        W = w / len;
+
+        return *this;
+#endif
+    }
+
+    YAX_INLINE Quaternion& Quaternion::operator/=(float f)
+    {
+#ifdef YAX_SSE
+        _mm_storeu_ps(&X, _mm_div_ps(_mm_loadu_ps(&X), _mm_set1_ps(f)));
+        return *this;
+#else
+        this->X /= f;
+        this->Y /= f;
+        this->Z /= f;
+        this->W /= f;
+        return *this;
+#endif
+    }
+
+    YAX_INLINE Quaternion operator+(Quaternion lhs, const Quaternion& rhs)
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Quaternion operator-(Quaternion lhs, const Quaternion& rhs)
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Quaternion operator*(Quaternion lhs, const Quaternion& rhs)
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Quaternion operator*(Quaternion lhs, float rhs)
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Quaternion operator*(float lhs, const Quaternion& rhs)
+    {
+        return rhs*lhs;
+    }
+
+    YAX_INLINE Quaternion operator/(Quaternion lhs, const Quaternion& rhs)
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Quaternion operator/(Quaternion lhs, float rhs)
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Quaternion operator-(Quaternion rhs)
+    {
+#ifdef YAX_SSE
+        _mm_storeu_ps(&rhs.X, _mm_xor_ps(_mm_loadu_ps(&rhs.X), _mm_set1_ps(-0.0f)));
+#else
+        rhs.Conjugate();
+        rhs.W = -rhs.W;
+#endif
+        return rhs;
+    }
+
+    YAX_INLINE bool operator==(const Quaternion& lhs, const Quaternion& rhs)
+    {
+        using MathHelper::EqualWithinEpsilon;
+
+        return EqualWithinEpsilon(lhs.X, rhs.X) 
+            && EqualWithinEpsilon(lhs.Y, rhs.Y)
+            && EqualWithinEpsilon(lhs.Z, rhs.Z)
+            && EqualWithinEpsilon(lhs.W, rhs.W);
+    }
+
+    YAX_INLINE bool operator!=(const Quaternion& lhs, const Quaternion& rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
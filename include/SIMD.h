@@ -0,0 +1,685 @@
+#ifndef _SIMD_H
+#define _SIMD_H
+
+//SSE2 is enabled whenever the target guarantees it (always the case on x86_64).
+//YAX_AVX is defined when the compiler is targeting AVX (/arch:AVX, -mavx), and every AVX path is used.
+//Otherwise, kernels marked YAX_TARGET_AVX are still compiled for AVX and picked at runtime if SupportsAVX().
+//Define YAX_NO_SIMD to force the scalar code paths.
+#if !defined(YAX_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define YAX_SSE
+    #include <emmintrin.h>
+    #include <immintrin.h>
+
+    #if defined(__AVX__)
+        #define YAX_AVX
+    #endif
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#endif
+
+#if defined(_MSC_VER)
+    #define YAX_FORCEINLINE __forceinline
+#else
+    #define YAX_FORCEINLINE inline __attribute__((always_inline))
+#endif
+
+//MSVC allows AVX intrinsics anywhere; GCC and Clang need each function that uses them to be compiled for AVX
+#if defined(YAX_AVX) || defined(_MSC_VER)
+    #define YAX_TARGET_AVX
+#else
+    #define YAX_TARGET_AVX __attribute__((target("avx")))
+#endif
+
+namespace YAX
+{
+    namespace SIMD
+    {
+#ifdef YAX_SSE
+        /**
+        * @brief Multiplies a single row vector by a row-major 4x4 matrix given as four row registers
+        *
+        * The products are summed in the same order as the scalar code, so results are identical.
+        */
+        YAX_FORCEINLINE __m128 MultiplyRow(__m128 row, __m128 b0, __m128 b1, __m128 b2, __m128 b3)
+        {
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+            return r;
+        }
+#endif
+
+#ifdef YAX_AVX
+        /**
+        * @brief AVX version of MultiplyRow that handles two rows at once
+        *
+        * @param rows Two consecutive rows of the left-hand matrix
+        * @param b0, b1, b2, b3 Rows of the right-hand matrix, duplicated into both 128-bit lanes
+        */
+        YAX_FORCEINLINE __m256 MultiplyRows(__m256 rows, __m256 b0, __m256 b1, __m256 b2, __m256 b3)
+        {
+            __m256 r = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+            r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+            r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+            r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+            return r;
+        }
+
+        /**
+        * @brief Loads two consecutive rows as two 128-bit halves
+        *
+        * Callers usually write matrices 16 bytes at a time, and a single 32-byte load spanning two such
+        * stores can't be forwarded from the store buffer, which made this path slower than the SSE one.
+        */
+        YAX_FORCEINLINE __m256 LoadRows(const float* rows)
+        {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(rows)), _mm_loadu_ps(rows + 4), 1);
+        }
+#endif
+
+#ifdef YAX_SSE
+        /**
+        * @brief The right-hand side of a 4x4 matrix product, loaded into registers once so it can be reused
+        */
+        struct MatrixOperand
+        {
+#ifdef YAX_AVX
+            __m256 B0, B1, B2, B3;
+
+            explicit MatrixOperand(const float* b)
+                : B0(_mm256_broadcast_ps(reinterpret_cast<const __m128*>(b))),
+                  B1(_mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4))),
+                  B2(_mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8))),
+                  B3(_mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12)))
+            {}
+#else
+            __m128 B0, B1, B2, B3;
+
+            explicit MatrixOperand(const float* b)
+                : B0(_mm_loadu_ps(b)), B1(_mm_loadu_ps(b + 4)), B2(_mm_loadu_ps(b + 8)), B3(_mm_loadu_ps(b + 12))
+            {}
+#endif
+        };
+
+        /**
+        * @brief Multiplies a row-major 4x4 matrix stored as 16 contiguous floats by a preloaded matrix
+        *
+        * No alignment is required, and out may alias a.
+        */
+        YAX_FORCEINLINE void MultiplyMatrix(const float* a, const MatrixOperand& b, float* out)
+        {
+#ifdef YAX_AVX
+            __m256 r01 = MultiplyRows(LoadRows(a), b.B0, b.B1, b.B2, b.B3);
+            __m256 r23 = MultiplyRows(LoadRows(a + 8), b.B0, b.B1, b.B2, b.B3);
+
+            _mm256_storeu_ps(out, r01);
+            _mm256_storeu_ps(out + 8, r23);
+#else
+            __m128 r0 = MultiplyRow(_mm_loadu_ps(a), b.B0, b.B1, b.B2, b.B3);
+            __m128 r1 = MultiplyRow(_mm_loadu_ps(a + 4), b.B0, b.B1, b.B2, b.B3);
+            __m128 r2 = MultiplyRow(_mm_loadu_ps(a + 8), b.B0, b.B1, b.B2, b.B3);
+            __m128 r3 = MultiplyRow(_mm_loadu_ps(a + 12), b.B0, b.B1, b.B2, b.B3);
+
+            _mm_storeu_ps(out, r0);
+            _mm_storeu_ps(out + 4, r1);
+            _mm_storeu_ps(out + 8, r2);
+            _mm_storeu_ps(out + 12, r3);
+#endif
+        }
+
+        /**
+        * @brief Multiplies two row-major 4x4 matrices stored as 16 contiguous floats
+        *
+        * No alignment is required, and out may alias either a or b.
+        */
+        YAX_FORCEINLINE void MultiplyMatrix(const float* a, const float* b, float* out)
+        {
+            MultiplyMatrix(a, MatrixOperand(b), out);
+        }
+
+        /**
+        * @brief Aligned version of MultiplyMatrix
+        *
+        * a and out must be 32-byte aligned (16-byte when AVX is not enabled), and out may alias a.
+        */
+        YAX_FORCEINLINE void MultiplyMatrixAligned(const float* a, const MatrixOperand& b, float* out)
+        {
+#ifdef YAX_AVX
+            __m256 r01 = MultiplyRows(_mm256_load_ps(a), b.B0, b.B1, b.B2, b.B3);
+            __m256 r23 = MultiplyRows(_mm256_load_ps(a + 8), b.B0, b.B1, b.B2, b.B3);
+
+            _mm256_store_ps(out, r01);
+            _mm256_store_ps(out + 8, r23);
+#else
+            __m128 r0 = MultiplyRow(_mm_load_ps(a), b.B0, b.B1, b.B2, b.B3);
+            __m128 r1 = MultiplyRow(_mm_load_ps(a + 4), b.B0, b.B1, b.B2, b.B3);
+            __m128 r2 = MultiplyRow(_mm_load_ps(a + 8), b.B0, b.B1, b.B2, b.B3);
+            __m128 r3 = MultiplyRow(_mm_load_ps(a + 12), b.B0, b.B1, b.B2, b.B3);
+
+            _mm_store_ps(out, r0);
+            _mm_store_ps(out + 4, r1);
+            _mm_store_ps(out + 8, r2);
+            _mm_store_ps(out + 12, r3);
+#endif
+        }
+
+        /**
+        * @brief Transforms the point (x, y, z, 1) by a row-major 4x4 matrix given as four row registers
+        *
+        * The w lane of v is ignored. The products are summed in the same order as the scalar code.
+        */
+        YAX_FORCEINLINE __m128 TransformPoint(__m128 v, __m128 b0, __m128 b1, __m128 b2, __m128 b3)
+        {
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+            return _mm_add_ps(r, b3);
+        }
+
+        /** @brief Transforms the direction (x, y, z, 0) by the upper 3x3 of a matrix given as three row registers */
+        YAX_FORCEINLINE __m128 TransformDirection(__m128 v, __m128 b0, __m128 b1, __m128 b2)
+        {
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+            return _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+        }
+
+        /** @brief Calculates the dot product of two registers, splatted to all lanes */
+        YAX_FORCEINLINE __m128 Dot4(__m128 a, __m128 b)
+        {
+            __m128 m = _mm_mul_ps(a, b);
+            __m128 x = _mm_shuffle_ps(m, m, _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 y = _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1));
+            __m128 z = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 2, 2, 2));
+            __m128 w = _mm_shuffle_ps(m, m, _MM_SHUFFLE(3, 3, 3, 3));
+            return _mm_add_ps(_mm_add_ps(_mm_add_ps(x, y), z), w);
+        }
+#endif
+
+#ifdef YAX_SSE
+        /**
+        * @brief Deinterleaves four packed Vector3s into one register per component
+        *
+        * @param a, b, c The packed Vector3s, loaded as (x0 y0 z0 x1), (y1 z1 x2 y2), (z2 x3 y3 z3)
+        * @param x, y, z Output for (x0 x1 x2 x3), (y0 y1 y2 y3), (z0 z1 z2 z3)
+        */
+        YAX_FORCEINLINE void Deinterleave3(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z)
+        {
+            __m128 bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+            x = _mm_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+
+            __m128 ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+            bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+            y = _mm_shuffle_ps(ab, bc, _MM_SHUFFLE(2, 0, 2, 0));
+
+            ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+            z = _mm_shuffle_ps(ab, c, _MM_SHUFFLE(3, 0, 2, 0));
+        }
+
+        /** @brief The inverse of Deinterleave3 */
+        YAX_FORCEINLINE void Interleave3(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c)
+        {
+            a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+            b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+            c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        }
+#endif
+
+#ifdef YAX_SSE
+        /**
+        * @brief Checks once whether the CPU and OS support AVX, for kernels that are picked at runtime
+        */
+        inline bool SupportsAVX()
+        {
+#if defined(YAX_AVX)
+            return true;
+#elif defined(_MSC_VER)
+            //CPUID.1:ECX has the AVX and OSXSAVE bits; XCR0 says whether the OS saves the XMM and YMM registers
+            static const bool supported = []
+            {
+                int info[4];
+                __cpuid(info, 1);
+                return (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+            }();
+            return supported;
+#else
+            static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports("avx") != 0);
+            return supported;
+#endif
+        }
+
+        /**
+        * @brief AVX version of Deinterleave3 for eight packed Vector3s
+        *
+        * Each 128-bit lane holds four of the Vector3s, as loaded by LoadPacked3.
+        */
+        YAX_FORCEINLINE YAX_TARGET_AVX void Deinterleave3(__m256 a, __m256 b, __m256 c, __m256& x, __m256& y, __m256& z)
+        {
+            __m256 bc = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+            x = _mm256_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+
+            __m256 ab = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+            bc = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+            y = _mm256_shuffle_ps(ab, bc, _MM_SHUFFLE(2, 0, 2, 0));
+
+            ab = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+            z = _mm256_shuffle_ps(ab, c, _MM_SHUFFLE(3, 0, 2, 0));
+        }
+
+        /** @brief The inverse of the AVX Deinterleave3 */
+        YAX_FORCEINLINE YAX_TARGET_AVX void Interleave3(__m256 x, __m256 y, __m256 z, __m256& a, __m256& b, __m256& c)
+        {
+            a = _mm256_shuffle_ps(_mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+            b = _mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+            c = _mm256_shuffle_ps(_mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        }
+
+        /**
+        * @brief Loads eight packed Vector3s (24 floats) so that each 128-bit lane holds four of them
+        */
+        YAX_FORCEINLINE YAX_TARGET_AVX void LoadPacked3(const float* p, __m256& a, __m256& b, __m256& c)
+        {
+            a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 12), 1);
+            b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+            c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+        }
+
+        /** @brief The inverse of LoadPacked3 */
+        YAX_FORCEINLINE YAX_TARGET_AVX void StorePacked3(float* p, __m256 a, __m256 b, __m256 c)
+        {
+            _mm_storeu_ps(p, _mm256_castps256_ps128(a));
+            _mm_storeu_ps(p + 4, _mm256_castps256_ps128(b));
+            _mm_storeu_ps(p + 8, _mm256_castps256_ps128(c));
+            _mm_storeu_ps(p + 12, _mm256_extractf128_ps(a, 1));
+            _mm_storeu_ps(p + 16, _mm256_extractf128_ps(b, 1));
+            _mm_storeu_ps(p + 20, _mm256_extractf128_ps(c, 1));
+        }
+#endif
+
+#ifdef YAX_SSE
+        //Calculates the translation row of an inverted affine matrix, (-t*inv3x3, 1)
+        YAX_FORCEINLINE __m128 InverseTranslation(__m128 t, __m128 i0, __m128 i1, __m128 i2)
+        {
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0)), i0);
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)), i1));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2)), i2));
+            return _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), r);
+        }
+
+        /** @brief Calculates the cross product of the xyz components of two registers; w is set to 0 */
+        YAX_FORCEINLINE __m128 Cross3(__m128 a, __m128 b)
+        {
+            __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+            __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+            __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+            return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+        }
+
+        /** @brief Calculates the dot product of the xyz components of two registers, splatted to all lanes */
+        YAX_FORCEINLINE __m128 Dot3(__m128 a, __m128 b)
+        {
+            __m128 m = _mm_mul_ps(a, b);
+            __m128 x = _mm_shuffle_ps(m, m, _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 y = _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1));
+            __m128 z = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 2, 2, 2));
+            return _mm_add_ps(_mm_add_ps(x, y), z);
+        }
+
+        /** @brief Picks each lane from a where mask is set and from b where it isn't */
+        YAX_FORCEINLINE __m128 Select(__m128 mask, __m128 a, __m128 b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+
+        /** @brief Clears the w lane of a register */
+        YAX_FORCEINLINE __m128 ClearW(__m128 v)
+        {
+            return _mm_and_ps(v, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+        }
+
+        //2x2 matrix helpers for Adjugate, each 2x2 matrix is stored row-major in one register
+        
+        //a*b
+        YAX_FORCEINLINE __m128 Mat2Mul(__m128 a, __m128 b)
+        {
+            return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        //adj(a)*b
+        YAX_FORCEINLINE __m128 Mat2AdjMul(__m128 a, __m128 b)
+        {
+            return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        //a*adj(b)
+        YAX_FORCEINLINE __m128 Mat2MulAdj(__m128 a, __m128 b)
+        {
+            return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        /** @brief The 2x2 blocks of a 4x4 matrix and the minors shared by Adjugate and Determinant */
+        struct BlockMinors
+        {
+            //The four 2x2 blocks: | A B |
+            //                     | C D |
+            __m128 A, B, C, D;
+
+            //(|A|, |B|, |C|, |D|)
+            __m128 DetSub;
+
+            //adj(A)*B and adj(D)*C
+            __m128 AB, DC;
+
+            explicit BlockMinors(const float* m)
+            {
+                __m128 r0 = _mm_loadu_ps(m);
+                __m128 r1 = _mm_loadu_ps(m + 4);
+                __m128 r2 = _mm_loadu_ps(m + 8);
+                __m128 r3 = _mm_loadu_ps(m + 12);
+
+                A = _mm_movelh_ps(r0, r1);
+                B = _mm_movehl_ps(r1, r0);
+                C = _mm_movelh_ps(r2, r3);
+                D = _mm_movehl_ps(r3, r2);
+
+                DetSub = _mm_sub_ps(
+                    _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+                    _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0))));
+
+                DC = Mat2AdjMul(D, C);
+                AB = Mat2AdjMul(A, B);
+            }
+        };
+
+        /** @brief Calculates the determinant of a 4x4 matrix from its block minors, splatted to all lanes */
+        YAX_FORCEINLINE __m128 Determinant(const BlockMinors& bm)
+        {
+            __m128 detA = _mm_shuffle_ps(bm.DetSub, bm.DetSub, _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 detB = _mm_shuffle_ps(bm.DetSub, bm.DetSub, _MM_SHUFFLE(1, 1, 1, 1));
+            __m128 detC = _mm_shuffle_ps(bm.DetSub, bm.DetSub, _MM_SHUFFLE(2, 2, 2, 2));
+            __m128 detD = _mm_shuffle_ps(bm.DetSub, bm.DetSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+            //|M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+            __m128 tr = _mm_mul_ps(bm.AB, _mm_shuffle_ps(bm.DC, bm.DC, _MM_SHUFFLE(3, 1, 2, 0)));
+            tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(2, 3, 0, 1)));
+            tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(1, 0, 3, 2)));
+            return _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+        }
+
+        /**
+        * @brief Calculates the adjugate of a row-major 4x4 matrix using 2x2 block decomposition
+        *
+        * @param m The matrix, as 16 contiguous floats
+        * @param adj Output for the four rows of the adjugate
+        * @return The determinant of m, splatted to all lanes
+        */
+        YAX_FORCEINLINE __m128 Adjugate(const float* m, __m128 adj[4])
+        {
+            BlockMinors bm(m);
+
+            __m128 detA = _mm_shuffle_ps(bm.DetSub, bm.DetSub, _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 detB = _mm_shuffle_ps(bm.DetSub, bm.DetSub, _MM_SHUFFLE(1, 1, 1, 1));
+            __m128 detC = _mm_shuffle_ps(bm.DetSub, bm.DetSub, _MM_SHUFFLE(2, 2, 2, 2));
+            __m128 detD = _mm_shuffle_ps(bm.DetSub, bm.DetSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+            //Blocks of the adjugate, before the final adjugate/sign shuffle
+            __m128 x = _mm_sub_ps(_mm_mul_ps(detD, bm.A), Mat2Mul(bm.B, bm.DC));
+            __m128 w = _mm_sub_ps(_mm_mul_ps(detA, bm.D), Mat2Mul(bm.C, bm.AB));
+            __m128 y = _mm_sub_ps(_mm_mul_ps(detB, bm.C), Mat2MulAdj(bm.D, bm.AB));
+            __m128 z = _mm_sub_ps(_mm_mul_ps(detC, bm.B), Mat2MulAdj(bm.A, bm.DC));
+
+            const __m128 sign = _mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f);
+            x = _mm_mul_ps(x, sign);
+            y = _mm_mul_ps(y, sign);
+            z = _mm_mul_ps(z, sign);
+            w = _mm_mul_ps(w, sign);
+
+            adj[0] = _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3));
+            adj[1] = _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2));
+            adj[2] = _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3));
+            adj[3] = _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2));
+
+            return Determinant(bm);
+        }
+
+        /**
+        * @brief Inverts the upper 3x3 of an affine matrix given as row registers and back-substitutes its translation
+        *
+        * The w lanes of the rows are ignored.
+        *
+        * @param r0, r1, r2 The rows of the upper 3x3
+        * @param t The translation row
+        * @param inv Output for the four rows of the inverse
+        * @return The determinant of the upper 3x3, splatted to all lanes
+        */
+        YAX_FORCEINLINE __m128 InvertAffineRows(__m128 r0, __m128 r1, __m128 r2, __m128 t, __m128 inv[4])
+        {
+            r0 = ClearW(r0);
+            r1 = ClearW(r1);
+            r2 = ClearW(r2);
+            t = ClearW(t);
+
+            //Rows of the 3x3 cofactor matrix
+            __m128 c0 = Cross3(r1, r2);
+            __m128 c1 = Cross3(r2, r0);
+            __m128 c2 = Cross3(r0, r1);
+            __m128 c3 = _mm_setzero_ps();
+
+            __m128 det = Dot3(r0, c0);
+
+            //The inverse of the 3x3 is the transposed cofactor matrix over the determinant
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+            __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+            c0 = _mm_mul_ps(c0, invDet);
+            c1 = _mm_mul_ps(c1, invDet);
+            c2 = _mm_mul_ps(c2, invDet);
+
+            inv[0] = c0;
+            inv[1] = c1;
+            inv[2] = c2;
+            inv[3] = InverseTranslation(t, c0, c1, c2);
+
+            return det;
+        }
+
+        /**
+        * @brief Inverts the upper 3x3 of an affine matrix and back-substitutes its translation
+        *
+        * The fourth column of m is assumed to be (0, 0, 0, 1).
+        *
+        * @param m The matrix, as 16 contiguous floats
+        * @param inv Output for the four rows of the inverse
+        * @return The determinant of m, splatted to all lanes
+        */
+        YAX_FORCEINLINE __m128 InvertAffine(const float* m, __m128 inv[4])
+        {
+            return InvertAffineRows(_mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12), inv);
+        }
+
+        /**
+        * @brief Inverts a rotation and translation given as row registers; the w lanes of the rows are ignored
+        *
+        * @param r0, r1, r2 The rows of the rotation
+        * @param t The translation row
+        * @param inv Output for the four rows of the inverse
+        */
+        YAX_FORCEINLINE void InvertRigidRows(__m128 r0, __m128 r1, __m128 r2, __m128 t, __m128 inv[4])
+        {
+            r0 = ClearW(r0);
+            r1 = ClearW(r1);
+            r2 = ClearW(r2);
+            t = ClearW(t);
+            __m128 r3 = _mm_setzero_ps();
+
+            //The inverse of a rotation is its transpose
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+            inv[0] = r0;
+            inv[1] = r1;
+            inv[2] = r2;
+            inv[3] = InverseTranslation(t, r0, r1, r2);
+        }
+
+        /**
+        * @brief Inverts a matrix made only of a rotation and a translation
+        *
+        * @param m The matrix, as 16 contiguous floats
+        * @param inv Output for the four rows of the inverse
+        */
+        YAX_FORCEINLINE void InvertRigid(const float* m, __m128 inv[4])
+        {
+            InvertRigidRows(_mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12), inv);
+        }
+
+        /**
+        * @brief Loads the rows of a 3x4 affine matrix stored as 12 contiguous floats
+        *
+        * The w lanes of the rows are unspecified. No memory past the 12 floats is read.
+        */
+        YAX_FORCEINLINE void LoadAffine(const float* m, __m128 rows[4])
+        {
+            __m128 last = _mm_loadu_ps(m + 8);
+
+            rows[0] = _mm_loadu_ps(m);
+            rows[1] = _mm_loadu_ps(m + 3);
+            rows[2] = _mm_loadu_ps(m + 6);
+            rows[3] = _mm_shuffle_ps(last, last, _MM_SHUFFLE(3, 3, 2, 1));
+        }
+
+        /**
+        * @brief Stores the xyz lanes of four row registers as a 3x4 affine matrix of 12 contiguous floats
+        *
+        * No memory past the 12 floats is written.
+        */
+        YAX_FORCEINLINE void StoreAffine(float* m, const __m128 rows[4])
+        {
+            //(r2.z, r3.x, r3.y, r3.z)
+            __m128 last = _mm_shuffle_ps(rows[2], rows[3], _MM_SHUFFLE(0, 0, 2, 2));
+            last = _mm_shuffle_ps(last, rows[3], _MM_SHUFFLE(2, 1, 2, 0));
+
+            //The stores overlap, each one overwriting the unspecified w lane of the one before it
+            _mm_storeu_ps(m, rows[0]);
+            _mm_storeu_ps(m + 3, rows[1]);
+            _mm_storeu_ps(m + 6, rows[2]);
+            _mm_storeu_ps(m + 8, last);
+        }
+
+        /**
+        * @brief Multiplies two 3x4 affine matrices given as row registers
+        *
+        * The implied fourth column (0, 0, 0, 1) is never multiplied, so this takes 36 multiplies instead of 64.
+        * The w lanes of the inputs are ignored and the w lanes of the results are unspecified.
+        */
+        YAX_FORCEINLINE void MultiplyAffine(const __m128 a[4], const __m128 b[4], __m128 out[4])
+        {
+            out[0] = TransformDirection(a[0], b[0], b[1], b[2]);
+            out[1] = TransformDirection(a[1], b[0], b[1], b[2]);
+            out[2] = TransformDirection(a[2], b[0], b[1], b[2]);
+            out[3] = TransformPoint(a[3], b[0], b[1], b[2], b[3]);
+        }
+#endif
+
+#ifdef YAX_SSE
+        //Quaternion helpers; each quaternion is one (x, y, z, w) register, and the sign masks negate individual lanes
+
+        /**
+        * @brief Calculates the Hamilton product a*b
+        *
+        * Summed term by term in the order a.w, a.x, a.y, a.z, the same order as the scalar code.
+        */
+        YAX_FORCEINLINE __m128 QuaternionMultiply(__m128 a, __m128 b)
+        {
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), b);
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)),
+                _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f))));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)),
+                _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f))));
+            return _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)),
+                _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f))));
+        }
+
+        /**
+        * @brief Calculates conjugate(b)*a, which Quaternion::operator/= divides by |b|^2 to get a/b
+        *
+        * Summed term by term in the order b.w, b.x, b.y, b.z, the same order as the scalar code.
+        */
+        YAX_FORCEINLINE __m128 QuaternionMultiplyConjugate(__m128 a, __m128 b)
+        {
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 3, 3)), a);
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0)),
+                _mm_xor_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f))));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1)),
+                _mm_xor_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f))));
+            return _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2)),
+                _mm_xor_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f))));
+        }
+
+        /**
+        * @brief Converts four quaternions to Scale * Rotation * Translation matrices
+        *
+        * The quaternions are transposed so each register holds one component of all four, and the rotation
+        * entries are calculated in the same order as Matrix::CreateFromQuaternion.
+        *
+        * @param q Four packed (x, y, z, w) quaternions
+        * @param scale Four packed (x, y, z) scale factors; nullptr for no scaling
+        * @param translation Four packed (x, y, z) translations; nullptr for no translation
+        * @param rows Output for the rows of each matrix, rows[i][r] being row r of the matrix for quaternion i
+        */
+        YAX_FORCEINLINE void QuaternionsToRows(const float* q, const float* scale, const float* translation, __m128 rows[4][4])
+        {
+            __m128 x = _mm_loadu_ps(q), y = _mm_loadu_ps(q + 4), z = _mm_loadu_ps(q + 8), w = _mm_loadu_ps(q + 12);
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 two = _mm_set1_ps(2.0f);
+            __m128 x2 = _mm_mul_ps(two, x), y2 = _mm_mul_ps(two, y), z2 = _mm_mul_ps(two, z);
+
+            __m128 xx = _mm_mul_ps(x2, x), yy = _mm_mul_ps(y2, y), zz = _mm_mul_ps(z2, z);
+            __m128 xy = _mm_mul_ps(x2, y), xz = _mm_mul_ps(x2, z), yz = _mm_mul_ps(y2, z);
+            __m128 xw = _mm_mul_ps(x2, w), yw = _mm_mul_ps(y2, w), zw = _mm_mul_ps(z2, w);
+
+            __m128 r0[4] = { _mm_sub_ps(_mm_sub_ps(one, yy), zz), _mm_add_ps(xy, zw), _mm_sub_ps(xz, yw), _mm_setzero_ps() };
+            __m128 r1[4] = { _mm_sub_ps(xy, zw), _mm_sub_ps(_mm_sub_ps(one, xx), zz), _mm_add_ps(yz, xw), _mm_setzero_ps() };
+            __m128 r2[4] = { _mm_add_ps(xz, yw), _mm_sub_ps(yz, xw), _mm_sub_ps(_mm_sub_ps(one, xx), yy), _mm_setzero_ps() };
+            __m128 r3[4] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), one };
+
+            if (scale)
+            {
+                __m128 sx, sy, sz;
+                Deinterleave3(_mm_loadu_ps(scale), _mm_loadu_ps(scale + 4), _mm_loadu_ps(scale + 8), sx, sy, sz);
+
+                for (int c = 0; c < 3; c++)
+                {
+                    r0[c] = _mm_mul_ps(r0[c], sx);
+                    r1[c] = _mm_mul_ps(r1[c], sy);
+                    r2[c] = _mm_mul_ps(r2[c], sz);
+                }
+            }
+
+            if (translation)
+                Deinterleave3(_mm_loadu_ps(translation), _mm_loadu_ps(translation + 4), _mm_loadu_ps(translation + 8), r3[0], r3[1], r3[2]);
+
+            _MM_TRANSPOSE4_PS(r0[0], r0[1], r0[2], r0[3]);
+            _MM_TRANSPOSE4_PS(r1[0], r1[1], r1[2], r1[3]);
+            _MM_TRANSPOSE4_PS(r2[0], r2[1], r2[2], r2[3]);
+            _MM_TRANSPOSE4_PS(r3[0], r3[1], r3[2], r3[3]);
+
+            for (int i = 0; i < 4; i++)
+            {
+                rows[i][0] = r0[i];
+                rows[i][1] = r1[i];
+                rows[i][2] = r2[i];
+                rows[i][3] = r3[i];
+            }
+        }
+#endif
+    }
+}
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef _SOA_STORAGE_H
+#define _SOA_STORAGE_H
+
+#include <algorithm>
+#include <vector>
+#include "Utils.h"
+
+namespace YAX
+{
+    namespace Detail
+    {
+        /**
+        * @brief The storage shared by the structure-of-arrays containers: Components float arrays laid out back to back
+        *
+        * Every array is 32-byte aligned and padded to a multiple of Width floats. Width is 8 because that's one AVX
+        * register (and two SSE registers), so kernels can run whole registers over the padding without a scalar tail
+        * whichever instruction set they were built for, and the arrays stay aligned for both.
+        *
+        * @tparam Components The number of component arrays
+        */
+        template <ui32 Components>
+        class SoAStorage
+        {
+        public:
+            static constexpr ui32 Width = 8;
+
+            SoAStorage()
+                : size(0)
+            {}
+
+            ui32 Size() const
+            {
+                return size;
+            }
+
+            ui32 PaddedSize() const
+            {
+                return Padded(size);
+            }
+
+            //Changes the number of elements, keeping the existing ones and zeroing new ones
+            void Resize(ui32 count)
+            {
+                ui32 oldPadded = PaddedSize();
+                ui32 newPadded = Padded(count);
+
+                if (newPadded != oldPadded)
+                {
+                    std::vector<float, AlignedAllocator<float, 32>> resized(Components * newPadded, 0.0f);
+                    ui32 kept = std::min(size, count);
+
+                    for (ui32 c = 0; c < Components; c++)
+                    {
+                        std::copy(data.begin() + c*oldPadded, data.begin() + c*oldPadded + kept, resized.begin() + c*newPadded);
+                    }
+
+                    data.swap(resized);
+                }
+                else
+                {
+                    //Elements past the old size may hold stale values from an earlier shrink
+                    for (ui32 c = 0; c < Components && count > size; c++)
+                    {
+                        std::fill(data.begin() + c*newPadded + size, data.begin() + c*newPadded + count, 0.0f);
+                    }
+                }
+
+                size = count;
+            }
+
+            float* Component(ui32 c)
+            {
+                return data.data() + c * PaddedSize();
+            }
+
+            const float* Component(ui32 c) const
+            {
+                return data.data() + c * PaddedSize();
+            }
+
+            //Every component array, one after another, for kernels that treat all components alike
+            float* Lanes()
+            {
+                return data.data();
+            }
+
+            const float* Lanes() const
+            {
+                return data.data();
+            }
+
+            //The length of Lanes(), including padding
+            ui32 LaneCount() const
+            {
+                return Components * PaddedSize();
+            }
+
+        private:
+            static ui32 Padded(ui32 count)
+            {
+                return (count + Width - 1) / Width * Width;
+            }
+
+            std::vector<float, AlignedAllocator<float, 32>> data;
+            ui32 size;
+        };
+
+        //Lanewise kernels over 32-byte aligned arrays whose length is a multiple of SoAStorage::Width, e.g. SoAStorage::Lanes()
+        void LerpLanes(const float* a, const float* b, float t, float* dest, ui32 count);
+        void MaxLanes(const float* a, const float* b, float* dest, ui32 count);
+        void MinLanes(const float* a, const float* b, float* dest, ui32 count);
+    }
+}
+
+#ifdef YAX_MATH_INLINE
+#include "SoAStorage.inl"
+#endif
+
+#endif
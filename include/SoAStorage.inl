@@ -0,0 +1,77 @@
+#include "MathHelper.h"
+#include "SIMD.h"
+
+namespace YAX
+{
+    namespace Detail
+    {
+        //With AVX, the arrays are processed a whole Width (one register) at a time. These kernels do one or two operations
+        //per load and are limited by memory bandwidth, so unlike TransformLanes they don't pick AVX at runtime; the AVX
+        //branches are only compiled when the compiler targets AVX
+        YAX_INLINE void LerpLanes(const float* a, const float* b, float t, float* dest, ui32 count)
+        {
+#if defined(YAX_AVX)
+            __m256 vt = _mm256_set1_ps(t);
+            for (ui32 i = 0; i < count; i += 8)
+            {
+                __m256 va = _mm256_load_ps(a + i);
+                __m256 vb = _mm256_load_ps(b + i);
+                _mm256_store_ps(dest + i, _mm256_add_ps(va, _mm256_mul_ps(_mm256_sub_ps(vb, va), vt)));
+            }
+#elif defined(YAX_SSE)
+            __m128 vt = _mm_set1_ps(t);
+            for (ui32 i = 0; i < count; i += 4)
+            {
+                __m128 va = _mm_load_ps(a + i);
+                __m128 vb = _mm_load_ps(b + i);
+                _mm_store_ps(dest + i, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), vt)));
+            }
+#else
+            for (ui32 i = 0; i < count; i++)
+            {
+                dest[i] = MathHelper::Lerp(a[i], b[i], t);
+            }
+#endif
+        }
+
+        YAX_INLINE void MaxLanes(const float* a, const float* b, float* dest, ui32 count)
+        {
+#if defined(YAX_AVX)
+            for (ui32 i = 0; i < count; i += 8)
+            {
+                _mm256_store_ps(dest + i, _mm256_max_ps(_mm256_load_ps(a + i), _mm256_load_ps(b + i)));
+            }
+#elif defined(YAX_SSE)
+            for (ui32 i = 0; i < count; i += 4)
+            {
+                _mm_store_ps(dest + i, _mm_max_ps(_mm_load_ps(a + i), _mm_load_ps(b + i)));
+            }
+#else
+            for (ui32 i = 0; i < count; i++)
+            {
+                dest[i] = MathHelper::Max(a[i], b[i]);
+            }
+#endif
+        }
+
+        YAX_INLINE void MinLanes(const float* a, const float* b, float* dest, ui32 count)
+        {
+#if defined(YAX_AVX)
+            for (ui32 i = 0; i < count; i += 8)
+            {
+                _mm256_store_ps(dest + i, _mm256_min_ps(_mm256_load_ps(a + i), _mm256_load_ps(b + i)));
+            }
+#elif defined(YAX_SSE)
+            for (ui32 i = 0; i < count; i += 4)
+            {
+                _mm_store_ps(dest + i, _mm_min_ps(_mm_load_ps(a + i), _mm_load_ps(b + i)));
+            }
+#else
+            for (ui32 i = 0; i < count; i++)
+            {
+                dest[i] = MathHelper::Min(a[i], b[i]);
+            }
+#endif
+        }
+    }
+}
@@ -1,14 +1,83 @@
 #ifndef _UTILS_H
 #define _UTILS_H
 
+#include <cstddef>
 #include <cstdint>
+#include <new>
+#include <type_traits>
+
+//Defining YAX_MATH_INLINE makes the library header-only: every function body is pulled
+//into the headers and marked inline, so no .lib needs to be linked. Requires C++17.
+#ifdef YAX_MATH_INLINE
+    #define YAX_INLINE inline
+#else
+    #define YAX_INLINE
+#endif
 
 namespace YAX
 {
+    using i8 = int8_t;
+    using ui8 = uint8_t;
+    using i16 = int16_t;
+    using ui16 = uint16_t;
     using i32 = int32_t;
     using ui32 = uint32_t;
     using i64 = int64_t;
     using ui64 = uint64_t;
+
+    //Gets element index of an array whose elements are stride bytes apart, e.g. a member of interleaved vertex structs
+    template <typename T>
+    inline T& StridedElement(T* base, ui32 stride, ui32 index)
+    {
+        using Byte = typename std::conditional<std::is_const<T>::value, const char, char>::type;
+        return *reinterpret_cast<T*>(reinterpret_cast<Byte*>(base) + static_cast<std::size_t>(stride)*index);
+    }
+
+    /**
+    * @brief A standard allocator that aligns every allocation to Alignment bytes, so containers can be fed to aligned SIMD loads
+    *
+    * @tparam T The element type
+    * @tparam Alignment The alignment in bytes; must be a power of two
+    */
+    template <typename T, std::size_t Alignment>
+    struct AlignedAllocator
+    {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template <typename U>
+        constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+        {}
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T* p, std::size_t) noexcept
+        {
+            ::operator delete(p, std::align_val_t(Alignment));
+        }
+    };
+
+    template <typename T, typename U, std::size_t Alignment>
+    constexpr bool operator==(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&)
+    {
+        return true;
+    }
+
+    template <typename T, typename U, std::size_t Alignment>
+    constexpr bool operator!=(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&)
+    {
+        return false;
+    }
 }
 
 #endif
@@ -2,6 +2,7 @@
 #define _VEC2_H
 
 #include <vector>
+#include "Parallel.h"
 #include "Utils.h"
 
 namespace YAX
@@ -15,8 +16,8 @@ namespace YAX
 
         float X, Y;
         
-        Vector2(float val);
-        Vector2(float x, float y);
+        constexpr Vector2(float val);
+        constexpr Vector2(float x, float y);
 
         /**
         * @brief Normalizes the vector, maintaining direction but reducing its length to 1
@@ -157,7 +158,7 @@ namespace YAX
         * @brief Rotates a Vector2 by a quaternion
         *
         * @param v The Vector2 to rotate
-        * @param q The quaternion to apply
+        * @param q The quaternion to apply; must be normalized
         * @return The rotated Vector2
         */
         static Vector2 Transform(const Vector2& v, const Quaternion& q);
@@ -233,6 +234,86 @@ namespace YAX
         * @param dest The list to insert the transformed Vector2s into
         */
         static void TransformNormal(const std::vector<Vector2>& source, const Matrix& mat, std::vector<Vector2>& dest);
+
+        /**
+        * @brief Transforms an array of Vector2s by a matrix
+        *
+        * The strides let the Vector2s be members of larger structs, e.g. the positions of interleaved vertices,
+        * so they can be transformed in place without copying them out.
+        *
+        * @param source The first Vector2 to transform
+        * @param sourceStride The distance in bytes between consecutive Vector2s in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector2 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector2s in dest
+        * @param count The number of Vector2s to transform
+        */
+        static void Transform(const Vector2* source, ui32 sourceStride, const Matrix& mat, Vector2* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Rotates an array of Vector2s by a quaternion
+        *
+        * The quaternion is converted to a rotation matrix once, so each Vector2 costs the same as a TransformNormal.
+        *
+        * @param source The first Vector2 to rotate
+        * @param sourceStride The distance in bytes between consecutive Vector2s in source
+        * @param q The quaternion to apply; must be normalized
+        * @param dest The first Vector2 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector2s in dest
+        * @param count The number of Vector2s to rotate
+        */
+        static void Transform(const Vector2* source, ui32 sourceStride, const Quaternion& q, Vector2* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of normals by a matrix without applying translation
+        *
+        * @param source The first normal to transform
+        * @param sourceStride The distance in bytes between consecutive normals in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector2 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector2s in dest
+        * @param count The number of normals to transform
+        */
+        static void TransformNormal(const Vector2* source, ui32 sourceStride, const Matrix& mat, Vector2* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of Vector2s by a matrix, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The first Vector2 to transform
+        * @param sourceStride The distance in bytes between consecutive Vector2s in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector2 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector2s in dest
+        * @param count The number of Vector2s to transform
+        */
+        static void Transform(ExecutionPolicy policy, const Vector2* source, ui32 sourceStride, const Matrix& mat, Vector2* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Rotates an array of Vector2s by a quaternion, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The first Vector2 to rotate
+        * @param sourceStride The distance in bytes between consecutive Vector2s in source
+        * @param q The quaternion to apply; must be normalized
+        * @param dest The first Vector2 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector2s in dest
+        * @param count The number of Vector2s to rotate
+        */
+        static void Transform(ExecutionPolicy policy, const Vector2* source, ui32 sourceStride, const Quaternion& q, Vector2* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of normals by a matrix without applying translation, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The first normal to transform
+        * @param sourceStride The distance in bytes between consecutive normals in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector2 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector2s in dest
+        * @param count The number of normals to transform
+        */
+        static void TransformNormal(ExecutionPolicy policy, const Vector2* source, ui32 sourceStride, const Matrix& mat, Vector2* dest, ui32 destStride, ui32 count);
     
         Vector2& operator+=(const Vector2&); 
         Vector2& operator-=(const Vector2&);
@@ -253,7 +334,24 @@ namespace YAX
 
     bool operator==(const Vector2&, const Vector2&);
     bool operator!=(const Vector2&, const Vector2&);
+
+
+    constexpr Vector2::Vector2(float val)
+        : X(val), Y(val)
+    {}
+
+    constexpr Vector2::Vector2(float x, float y)
+        : X(x), Y(y)
+    {}
+
+    constexpr Vector2 Vector2::One = Vector2(1.0f);
+    constexpr Vector2 Vector2::UnitX = Vector2(1.0f, 0.0f);
+    constexpr Vector2 Vector2::UnitY = Vector2(0.0f, 1.0f);
+    constexpr Vector2 Vector2::Zero = Vector2(0.0f);
 }
 
+#ifdef YAX_MATH_INLINE
+#include "Vector2.inl"
+#endif
 
-#endif
\ No newline at end of file
+#endif
@@ -1,7 +1,9 @@
 #ifndef _VEC3_H
 #define _VEC3_H
 
+#include <functional>
 #include <vector>
+#include "Parallel.h"
 #include "Utils.h"
 
 namespace YAX
@@ -10,6 +12,9 @@ namespace YAX
     struct Quaternion;
     struct Vector2;
 
+    template <typename E>
+    struct MatrixExpression;
+
     struct Vector3
     {
         static const Vector3 One, UnitX, UnitY, UnitZ, Zero, 
@@ -18,10 +23,10 @@ namespace YAX
 
         float X, Y, Z;
 
-        Vector3();
-        Vector3(float val);
-        Vector3(float x, float y, float z);
-        Vector3(Vector2 xy, float z);
+        Vector3() = default;
+        constexpr Vector3(float val);
+        constexpr Vector3(float x, float y, float z);
+        constexpr Vector3(Vector2 xy, float z);
 
         /**
         * @brief Normalizes the vector, maintaining direction but reducing its length to 1
@@ -163,11 +168,23 @@ namespace YAX
         */
         static Vector3 Transform(const Vector3& v, const Matrix& m);
 
+        /**
+        * @brief Transforms a Vector3 by a lazy matrix product (see MatrixExpression.h)
+        *
+        * The vector is carried through each matrix in turn, so no intermediate matrix product is ever formed.
+        *
+        * @param v The vector to transform
+        * @param mat The matrix product expression
+        * @return The transformed Vector3
+        */
+        template <typename E>
+        static Vector3 Transform(const Vector3& v, const MatrixExpression<E>& mat);
+
         /**
         * @brief Rotates a Vector3 by a quaternion
         *
         * @param v The Vector3 to rotate
-        * @param q The quaternion to apply
+        * @param q The quaternion to apply; must be normalized
         * @return The rotated Vector3
         */
         static Vector3 Transform(const Vector3& v, const Quaternion& q);
@@ -244,6 +261,139 @@ namespace YAX
         */
         static void TransformNormal(const std::vector<Vector3>& source, const Matrix& mat, std::vector<Vector3>& dest);
 
+        /**
+        * @brief Transforms an array of Vector3s by a matrix
+        *
+        * The strides let the Vector3s be members of larger structs, e.g. the positions of interleaved vertices,
+        * so they can be transformed in place without copying them out.
+        * When both strides are sizeof(Vector3), the Vector3s are transformed several at a time with SIMD.
+        *
+        * @param source The first Vector3 to transform
+        * @param sourceStride The distance in bytes between consecutive Vector3s in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector3 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector3s in dest
+        * @param count The number of Vector3s to transform
+        */
+        static void Transform(const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Rotates an array of Vector3s by a quaternion
+        *
+        * The quaternion is converted to a rotation matrix once, so each Vector3 costs the same as a TransformNormal.
+        *
+        * @param source The first Vector3 to rotate
+        * @param sourceStride The distance in bytes between consecutive Vector3s in source
+        * @param q The quaternion to apply; must be normalized
+        * @param dest The first Vector3 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector3s in dest
+        * @param count The number of Vector3s to rotate
+        */
+        static void Transform(const Vector3* source, ui32 sourceStride, const Quaternion& q, Vector3* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of normals by a matrix without applying translation
+        *
+        * When both strides are sizeof(Vector3), the normals are transformed several at a time with SIMD.
+        *
+        * @param source The first normal to transform
+        * @param sourceStride The distance in bytes between consecutive normals in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector3 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector3s in dest
+        * @param count The number of normals to transform
+        */
+        static void TransformNormal(const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of surface normals by a matrix and renormalizes them
+        *
+        * Unlike TransformNormal, which applies the upper 3x3 of mat directly, this applies its inverse-transpose,
+        * so the normals stay perpendicular to their surfaces under non-uniform scale and shear. Zero-length results
+        * stay zero, and mat may be scaled down as far as the float range allows.
+        * The inverse-transpose is derived once per call, and with SIMD the lengths are found with a refined
+        * reciprocal square root, accurate to a few units in the last place.
+        *
+        * @param source The first normal to transform
+        * @param sourceStride The distance in bytes between consecutive normals in source
+        * @param mat The matrix that transforms the positions of the surface
+        * @param dest The first Vector3 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector3s in dest
+        * @param count The number of normals to transform
+        */
+        static void TransformSurfaceNormal(const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of Vector3s by a matrix, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The first Vector3 to transform
+        * @param sourceStride The distance in bytes between consecutive Vector3s in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector3 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector3s in dest
+        * @param count The number of Vector3s to transform
+        */
+        static void Transform(ExecutionPolicy policy, const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Rotates an array of Vector3s by a quaternion, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The first Vector3 to rotate
+        * @param sourceStride The distance in bytes between consecutive Vector3s in source
+        * @param q The quaternion to apply; must be normalized
+        * @param dest The first Vector3 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector3s in dest
+        * @param count The number of Vector3s to rotate
+        */
+        static void Transform(ExecutionPolicy policy, const Vector3* source, ui32 sourceStride, const Quaternion& q, Vector3* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of normals by a matrix without applying translation, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The first normal to transform
+        * @param sourceStride The distance in bytes between consecutive normals in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector3 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector3s in dest
+        * @param count The number of normals to transform
+        */
+        static void TransformNormal(ExecutionPolicy policy, const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of surface normals by a matrix and renormalizes them, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The first normal to transform
+        * @param sourceStride The distance in bytes between consecutive normals in source
+        * @param mat The matrix that transforms the positions of the surface
+        * @param dest The first Vector3 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector3s in dest
+        * @param count The number of normals to transform
+        */
+        static void TransformSurfaceNormal(ExecutionPolicy policy, const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms a stream of Vector3s that doesn't have to fit in memory, one chunk at a time
+        *
+        * Only three chunks are held at once. While one chunk is transformed on the calling thread, the next is read
+        * and the previous one is written on background threads, so I/O and computation overlap. Memory-mapped input
+        * can be streamed by a reader that copies from the mapping. An exception thrown by reader or writer is
+        * rethrown on the calling thread.
+        *
+        * @param reader Fills its buffer with up to capacity Vector3s and returns how many it wrote; 0 ends the stream
+        * @param mat The transformation matrix
+        * @param writer Receives each transformed chunk, in order; the buffer is only valid for the duration of the call
+        * @param chunkSize The number of Vector3s per chunk
+        * @param policy How to run the transform of each chunk; see Parallel::For
+        * @return The total number of Vector3s transformed
+        */
+        static ui64 TransformStream(const std::function<ui32(Vector3* buffer, ui32 capacity)>& reader, const Matrix& mat,
+                                    const std::function<void(const Vector3* buffer, ui32 count)>& writer,
+                                    ui32 chunkSize, ExecutionPolicy policy);
+
         Vector3& operator+=(const Vector3&);
         Vector3& operator-=(const Vector3&);
         Vector3& operator*=(const Vector3&);
@@ -269,5 +419,38 @@ namespace YAX
     bool operator<=(const Vector3&, const Vector3&);
 }
 
+//Included after the declarations above so that the headers can depend on each other
+#include "Vector2.h"
+
+namespace YAX
+{
+    constexpr Vector3::Vector3(float val)
+        : X(val), Y(val), Z(val)
+    {}
+
+    constexpr Vector3::Vector3(float x, float y, float z)
+        : X(x), Y(y), Z(z)
+    {}
+
+    constexpr Vector3::Vector3(Vector2 xy, float z)
+        : X(xy.X), Y(xy.Y), Z(z)
+    {}
+
+    constexpr Vector3 Vector3::One = Vector3(1.0f);
+    constexpr Vector3 Vector3::UnitX = Vector3(1.0f, 0.0f, 0.0f);
+    constexpr Vector3 Vector3::UnitY = Vector3(0.0f, 1.0f, 0.0f);
+    constexpr Vector3 Vector3::UnitZ = Vector3(0.0f, 0.0f, 1.0f);
+    constexpr Vector3 Vector3::Zero = Vector3(0.0f);
+    constexpr Vector3 Vector3::Backward = Vector3(0.0f, 0.0f, 1.0f);
+    constexpr Vector3 Vector3::Down = Vector3(0.0f, -1.0f, 0.0f);
+    constexpr Vector3 Vector3::Forward = Vector3(0.0f, 0.0f, -1.0f);
+    constexpr Vector3 Vector3::Left = Vector3(-1.0f, 0.0f, 0.0f);
+    constexpr Vector3 Vector3::Right = Vector3(1.0f, 0.0f, 0.0f);
+    constexpr Vector3 Vector3::Up = Vector3(0.0f, 1.0f, 0.0f);
+}
+
+#ifdef YAX_MATH_INLINE
+#include "Vector3.inl"
+#endif
 
-#endif
\ No newline at end of file
+#endif
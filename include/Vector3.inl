@@ -0,0 +1,690 @@
+#include <cmath>
+#include <future>
+#include <limits>
+#include <memory>
+#include "MathHelper.h"
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "SIMD.h"
+#include "Utils.h"
+#include "Vector2.h"
+
+namespace YAX
+{
+    namespace Detail
+    {
+#if defined(YAX_SSE)
+        //The AVX part of TransformPacked, compiled for AVX even when the rest of the library isn't; only call it if SIMD::SupportsAVX()
+        YAX_INLINE YAX_TARGET_AVX ui32 TransformPackedAVX(const float* src, const Matrix& m, float* dst, ui32 count, bool translate)
+        {
+            __m256 m11 = _mm256_set1_ps(m.M11), m12 = _mm256_set1_ps(m.M12), m13 = _mm256_set1_ps(m.M13);
+            __m256 m21 = _mm256_set1_ps(m.M21), m22 = _mm256_set1_ps(m.M22), m23 = _mm256_set1_ps(m.M23);
+            __m256 m31 = _mm256_set1_ps(m.M31), m32 = _mm256_set1_ps(m.M32), m33 = _mm256_set1_ps(m.M33);
+            __m256 m41 = _mm256_set1_ps(m.M41), m42 = _mm256_set1_ps(m.M42), m43 = _mm256_set1_ps(m.M43);
+            ui32 i = 0;
+
+            for (; i + 8 <= count; i += 8)
+            {
+                __m256 a, b, c, x, y, z;
+                SIMD::LoadPacked3(src + 3 * i, a, b, c);
+                SIMD::Deinterleave3(a, b, c, x, y, z);
+
+                __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m11), _mm256_mul_ps(y, m21)), _mm256_mul_ps(z, m31));
+                __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m12), _mm256_mul_ps(y, m22)), _mm256_mul_ps(z, m32));
+                __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m13), _mm256_mul_ps(y, m23)), _mm256_mul_ps(z, m33));
+
+                if (translate)
+                {
+                    rx = _mm256_add_ps(rx, m41);
+                    ry = _mm256_add_ps(ry, m42);
+                    rz = _mm256_add_ps(rz, m43);
+                }
+
+                SIMD::Interleave3(rx, ry, rz, a, b, c);
+                SIMD::StorePacked3(dst + 3 * i, a, b, c);
+            }
+
+            return i;
+        }
+#endif
+
+        //Transforms tightly packed Vector3s 8 (AVX) or 4 (SSE) at a time by deinterleaving them into one
+        //register per component, so every lane does useful work. The products are summed in the same order
+        //as in Vector3::Transform, so the results are identical to the scalar loop.
+        //Returns the number of Vector3s transformed; the caller handles the remaining tail.
+        YAX_INLINE ui32 TransformPacked(const Vector3* source, const Matrix& m, Vector3* dest, ui32 count, bool translate)
+        {
+            static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be 3 tightly packed floats");
+
+            const float* src = &source->X;
+            float* dst = &dest->X;
+            ui32 i = 0;
+
+#if defined(YAX_SSE)
+            if (SIMD::SupportsAVX())
+                i = TransformPackedAVX(src, m, dst, count, translate);
+
+            {
+                __m128 m11 = _mm_set1_ps(m.M11), m12 = _mm_set1_ps(m.M12), m13 = _mm_set1_ps(m.M13);
+                __m128 m21 = _mm_set1_ps(m.M21), m22 = _mm_set1_ps(m.M22), m23 = _mm_set1_ps(m.M23);
+                __m128 m31 = _mm_set1_ps(m.M31), m32 = _mm_set1_ps(m.M32), m33 = _mm_set1_ps(m.M33);
+                __m128 m41 = _mm_set1_ps(m.M41), m42 = _mm_set1_ps(m.M42), m43 = _mm_set1_ps(m.M43);
+
+                for (; i + 4 <= count; i += 4)
+                {
+                    __m128 a = _mm_loadu_ps(src + 3 * i);
+                    __m128 b = _mm_loadu_ps(src + 3 * i + 4);
+                    __m128 c = _mm_loadu_ps(src + 3 * i + 8);
+                    __m128 x, y, z;
+                    SIMD::Deinterleave3(a, b, c, x, y, z);
+
+                    __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m11), _mm_mul_ps(y, m21)), _mm_mul_ps(z, m31));
+                    __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m12), _mm_mul_ps(y, m22)), _mm_mul_ps(z, m32));
+                    __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m13), _mm_mul_ps(y, m23)), _mm_mul_ps(z, m33));
+
+                    if (translate)
+                    {
+                        rx = _mm_add_ps(rx, m41);
+                        ry = _mm_add_ps(ry, m42);
+                        rz = _mm_add_ps(rz, m43);
+                    }
+
+                    SIMD::Interleave3(rx, ry, rz, a, b, c);
+                    _mm_storeu_ps(dst + 3 * i, a);
+                    _mm_storeu_ps(dst + 3 * i + 4, b);
+                    _mm_storeu_ps(dst + 3 * i + 8, c);
+                }
+            }
+#else
+            (void)src;
+            (void)dst;
+            (void)m;
+            (void)count;
+            (void)translate;
+#endif
+            return i;
+        }
+    }
+
+    YAX_INLINE void Vector3::Normalize()
+    {
+        float len = Length();
+        X /= len;
+        Y /= len;
+        Z /= len;
+    }
+
+    YAX_INLINE float Vector3::Length()	const
+    {
+        return std::sqrt(LengthSquared());
+    }
+
+    YAX_INLINE float Vector3::LengthSquared() const
+    {
+        return X*X + Y*Y + Z*Z;
+    }
+
+    YAX_INLINE Vector3 Vector3::Barycentric(const Vector3& p1, const Vector3& p2, const Vector3& p3, float b2, float b3)
+    {
+        return (1 - b2 - b3)*p1 + b2*p2 + b3*p3;
+    }
+
+    YAX_INLINE Vector3 Vector3::CatmullRom(const Vector3& p1, const Vector3& p2, const Vector3& p3, const Vector3& p4, float amt)
+    {
+        float x = MathHelper::CatmullRom(p1.X, p2.X, p3.X, p4.X, amt);
+        float y = MathHelper::CatmullRom(p1.Y, p2.Y, p3.Y, p4.Y, amt);
+        float z = MathHelper::CatmullRom(p1.Z, p2.Z, p3.Z, p4.Z, amt);
+    
+        return Vector3(x, y, z);
+    }
+
+    YAX_INLINE Vector3 Vector3::Clamp(const Vector3& val, const Vector3& min, const Vector3& max)
+    {
+        float x = MathHelper::Clamp(val.X, min.X, max.X);
+        float y = MathHelper::Clamp(val.Y, min.Y, max.Y);
+        float z = MathHelper::Clamp(val.Z, min.Z, max.Z);
+
+        return Vector3(x, y, z);
+    }
+
+    YAX_INLINE Vector3 Vector3::Cross(const Vector3& v1, const Vector3 v2)
+    {
+        float x = v1.Y*v2.Z - v1.Z*v2.Y;
+        float y = v1.Z*v2.X - v1.X*v2.Z;
+        float z = v1.X*v2.Y - v1.Y*v2.X;
+        return Vector3(x, y, z);
+    }
+
+    YAX_INLINE float Vector3::Distance(const Vector3& p1, const Vector3& p2)
+    {
+        return std::sqrt(DistanceSquared(p1, p2));
+    }
+
+    YAX_INLINE float Vector3::DistanceSquared(const Vector3& p1, const Vector3& p2)
+    {
+        return (p1 - p2).LengthSquared();
+    }
+
+    YAX_INLINE float Vector3::Dot(const Vector3& v1, const Vector3& v2)
+    {
+        return v1.X*v2.X + v1.Y*v2.Y + v1.Z*v2.Z;
+    }
+
+    YAX_INLINE Vector3 Vector3::Hermite(const Vector3& p1, const Vector3& t1, const Vector3& p2, const Vector3& t2, float w)
+    {
+        float x = MathHelper::Hermite(p1.X, t1.X, p2.X, t2.X, w);
+        float y = MathHelper::Hermite(p1.Y, t1.Y, p2.Y, t2.Y, w);
+        float z = MathHelper::Hermite(p1.Z, t1.Z, p2.Z, t2.Z, w);
+
+        return Vector3(x, y, z);
+    }
+
+    YAX_INLINE Vector3 Vector3::Lerp(const Vector3& p1, const Vector3& p2, float t)
+    {
+        float x = MathHelper::Lerp(p1.X, p2.X, t);
+        float y = MathHelper::Lerp(p1.Y, p2.Y, t);
+        float z = MathHelper::Lerp(p1.Z, p2.Z, t);
+
+        return Vector3(x, y, z);
+    }
+
+    YAX_INLINE Vector3 Vector3::Max(const Vector3& v1, const Vector3& v2)
+    {
+        float x = MathHelper::Max(v1.X, v2.X);
+        float y = MathHelper::Max(v1.Y, v2.Y);
+        float z = MathHelper::Max(v1.Z, v2.Z);
+
+        return Vector3(x, y, z);
+    }
+
+    YAX_INLINE Vector3 Vector3::Min(const Vector3& v1, const Vector3& v2)
+    {
+        float x = MathHelper::Min(v1.X, v2.X);
+        float y = MathHelper::Min(v1.Y, v2.Y);
+        float z = MathHelper::Min(v1.Z, v2.Z);
+
+        return Vector3(x, y, z);
+    }
+
+    YAX_INLINE Vector3 Vector3::Normalize(Vector3 vec)
+    {
+        vec.Normalize();
+        return vec;
+    }
+
+    YAX_INLINE Vector3 Vector3::Reflect(const Vector3& vec, const Vector3& norm)
+    {
+        Vector3 projection = Dot(vec, norm) * norm;
+        Vector3 perp = projection - vec;
+        return vec + 2 * perp;
+    }
+
+    YAX_INLINE Vector3 Vector3::SmoothStep(const Vector3& a, const Vector3& b, float t)
+    {
+        float x = MathHelper::SmoothStep(a.X, b.X, t);
+        float y = MathHelper::SmoothStep(a.Y, b.Y, t);
+        float z = MathHelper::SmoothStep(a.Z, b.Z, t);
+
+        return Vector3(x, y, z);
+    }
+
+    YAX_INLINE Vector3 Vector3::Transform(const Vector3& vec, const Matrix& mat)
+    {
+        return Vector3
+        (
+            vec.X*mat.M11 + vec.Y*mat.M21 + vec.Z*mat.M31 + mat.M41,
+            vec.X*mat.M12 + vec.Y*mat.M22 + vec.Z*mat.M32 + mat.M42,
+            vec.X*mat.M13 + vec.Y*mat.M23 + vec.Z*mat.M33 + mat.M43
+        );
+    }
+
+    YAX_INLINE Vector3 Vector3::Transform(const Vector3& vec, const Quaternion& q)
+    {
+        //q*v*q' expanded for a unit quaternion: v + w*t + q.xyz x t, where t = 2(q.xyz x v)
+        float tx = 2 * (q.Y*vec.Z - q.Z*vec.Y);
+        float ty = 2 * (q.Z*vec.X - q.X*vec.Z);
+        float tz = 2 * (q.X*vec.Y - q.Y*vec.X);
+
+        return Vector3
+        (
+            vec.X + q.W*tx + (q.Y*tz - q.Z*ty),
+            vec.Y + q.W*ty + (q.Z*tx - q.X*tz),
+            vec.Z + q.W*tz + (q.X*ty - q.Y*tx)
+        );
+    }
+
+    YAX_INLINE void Vector3::Transform(const std::vector<Vector3>& source, ui32 sourceIdx, const Matrix& mat, std::vector<Vector3>& dest, ui32 destIdx, ui32 count)
+    {
+        Transform(source.data() + sourceIdx, sizeof(Vector3), mat, dest.data() + destIdx, sizeof(Vector3), count);
+    }
+
+    YAX_INLINE void Vector3::Transform(const std::vector<Vector3>& source, ui32 sourceIdx, const Quaternion& q, std::vector<Vector3>& dest, ui32 destIdx, ui32 count)
+    {
+        Transform(source.data() + sourceIdx, sizeof(Vector3), q, dest.data() + destIdx, sizeof(Vector3), count);
+    }
+
+    YAX_INLINE void Vector3::Transform(const std::vector<Vector3>& source, const Matrix& mat, std::vector<Vector3>& dest)
+    {
+        Transform(source, 0, mat, dest, 0, (ui32)source.size());
+    }
+
+    YAX_INLINE void Vector3::Transform(const std::vector<Vector3>& source, const Quaternion& q, std::vector<Vector3>& dest)
+    {
+        Transform(source, 0, q, dest, 0, (ui32)source.size());
+    }
+
+    YAX_INLINE Vector3 Vector3::TransformNormal(const Vector3& norm, const Matrix& mat)
+    {
+        return Vector3
+        (
+            norm.X*mat.M11 + norm.Y*mat.M21 + norm.Z*mat.M31,
+            norm.X*mat.M12 + norm.Y*mat.M22 + norm.Z*mat.M32,
+            norm.X*mat.M13 + norm.Y*mat.M23 + norm.Z*mat.M33
+        );
+    }
+
+    YAX_INLINE void Vector3::TransformNormal(const std::vector<Vector3>& source, ui32 sourceIdx, const Matrix& mat, std::vector<Vector3>& dest, ui32 destIdx, ui32 count)
+    {
+        TransformNormal(source.data() + sourceIdx, sizeof(Vector3), mat, dest.data() + destIdx, sizeof(Vector3), count);
+    }
+
+    YAX_INLINE void Vector3::TransformNormal(const std::vector<Vector3>& source, const Matrix& mat, std::vector<Vector3>& dest)
+    {
+        TransformNormal(source, 0, mat, dest, 0, (ui32)source.size());
+    }
+
+    YAX_INLINE void Vector3::Transform(const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count)
+    {
+        //Copied so the compiler can keep it in registers even though dest may alias it
+        Matrix m = mat;
+        ui32 i = 0;
+
+        if (sourceStride == sizeof(Vector3) && destStride == sizeof(Vector3))
+            i = Detail::TransformPacked(source, m, dest, count, true);
+
+        for (; i < count; i++)
+        {
+            StridedElement(dest, destStride, i) = Transform(StridedElement(source, sourceStride, i), m);
+        }
+    }
+
+    YAX_INLINE void Vector3::Transform(const Vector3* source, ui32 sourceStride, const Quaternion& q, Vector3* dest, ui32 destStride, ui32 count)
+    {
+        TransformNormal(source, sourceStride, Matrix::CreateFromQuaternion(q), dest, destStride, count);
+    }
+
+    YAX_INLINE void Vector3::TransformNormal(const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count)
+    {
+        Matrix m = mat;
+        ui32 i = 0;
+
+        if (sourceStride == sizeof(Vector3) && destStride == sizeof(Vector3))
+            i = Detail::TransformPacked(source, m, dest, count, false);
+
+        for (; i < count; i++)
+        {
+            StridedElement(dest, destStride, i) = TransformNormal(StridedElement(source, sourceStride, i), m);
+        }
+    }
+
+    YAX_INLINE void Vector3::TransformSurfaceNormal(const Vector3* source, ui32 sourceStride, const Matrix& m, Vector3* dest, ui32 destStride, ui32 count)
+    {
+        //The inverse-transpose of the upper 3x3 is its cofactor matrix divided by the determinant. The results are
+        //renormalized, so only the sign of the determinant matters and the division is skipped. The cofactors of a
+        //tiny scale would be denormal and lose precision, so the 3x3 is first divided by its largest element; a
+        //uniform scale only scales the cofactors, and doesn't change the normalized results.
+        float a11 = m.M11, a12 = m.M12, a13 = m.M13;
+        float a21 = m.M21, a22 = m.M22, a23 = m.M23;
+        float a31 = m.M31, a32 = m.M32, a33 = m.M33;
+
+        float scale = std::fmax(std::fmax(std::fmax(std::fabs(a11), std::fabs(a12)), std::fmax(std::fabs(a13), std::fabs(a21))),
+                                std::fmax(std::fmax(std::fabs(a22), std::fabs(a23)), std::fmax(std::fmax(std::fabs(a31), std::fabs(a32)), std::fabs(a33))));
+        if (scale > 0)
+        {
+            a11 /= scale; a12 /= scale; a13 /= scale;
+            a21 /= scale; a22 /= scale; a23 /= scale;
+            a31 /= scale; a32 /= scale; a33 /= scale;
+        }
+
+        float c11 = a22*a33 - a23*a32;
+        float c12 = a23*a31 - a21*a33;
+        float c13 = a21*a32 - a22*a31;
+        float c21 = a32*a13 - a33*a12;
+        float c22 = a33*a11 - a31*a13;
+        float c23 = a31*a12 - a32*a11;
+        float c31 = a12*a23 - a13*a22;
+        float c32 = a13*a21 - a11*a23;
+        float c33 = a11*a22 - a12*a21;
+
+        float sign = a11*c11 + a12*c12 + a13*c13 < 0 ? -1.0f : 1.0f;
+
+        //The cofactors are still tiny when only some axes are scaled down, and the squared lengths of the results
+        //would underflow. Dividing by the largest cofactor keeps them near 1, again without changing the results.
+        float largest = std::fmax(std::fmax(std::fmax(std::fabs(c11), std::fabs(c12)), std::fmax(std::fabs(c13), std::fabs(c21))),
+                                  std::fmax(std::fmax(std::fabs(c22), std::fabs(c23)), std::fmax(std::fmax(std::fabs(c31), std::fabs(c32)), std::fabs(c33))));
+        if (largest > 0)
+        {
+            c11 /= largest; c12 /= largest; c13 /= largest;
+            c21 /= largest; c22 /= largest; c23 /= largest;
+            c31 /= largest; c32 /= largest; c33 /= largest;
+        }
+
+        c11 *= sign; c12 *= sign; c13 *= sign;
+        c21 *= sign; c22 *= sign; c23 *= sign;
+        c31 *= sign; c32 *= sign; c33 *= sign;
+
+#ifdef YAX_SSE
+        __m128 k11 = _mm_set1_ps(c11), k12 = _mm_set1_ps(c12), k13 = _mm_set1_ps(c13);
+        __m128 k21 = _mm_set1_ps(c21), k22 = _mm_set1_ps(c22), k23 = _mm_set1_ps(c23);
+        __m128 k31 = _mm_set1_ps(c31), k32 = _mm_set1_ps(c32), k33 = _mm_set1_ps(c33);
+        __m128 half = _mm_set1_ps(0.5f), threeHalves = _mm_set1_ps(1.5f), one = _mm_set1_ps(1.0f);
+        __m128 shortest = _mm_set1_ps(std::numeric_limits<float>::min());
+        bool packed = sourceStride == sizeof(Vector3) && destStride == sizeof(Vector3);
+
+        for (ui32 i = 0; i < count; i += 4)
+        {
+            ui32 lanes = count - i < 4 ? count - i : 4;
+            __m128 x, y, z;
+
+            if (packed && lanes == 4)
+            {
+                const float* src = &source[i].X;
+                SIMD::Deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+            }
+            else
+            {
+                alignas(16) float gx[4] = {}, gy[4] = {}, gz[4] = {};
+                for (ui32 k = 0; k < lanes; k++)
+                {
+                    const Vector3& n = StridedElement(source, sourceStride, i + k);
+                    gx[k] = n.X;
+                    gy[k] = n.Y;
+                    gz[k] = n.Z;
+                }
+
+                x = _mm_load_ps(gx);
+                y = _mm_load_ps(gy);
+                z = _mm_load_ps(gz);
+            }
+
+            __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, k11), _mm_mul_ps(y, k21)), _mm_mul_ps(z, k31));
+            __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, k12), _mm_mul_ps(y, k22)), _mm_mul_ps(z, k32));
+            __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, k13), _mm_mul_ps(y, k23)), _mm_mul_ps(z, k33));
+
+            //rsqrt is good to 12 bits; one Newton-Raphson step, y' = y(1.5 - 0.5x*y*y), brings it to about 22.
+            //rsqrt gives infinity for zero and denormal lengths, so those results are left unscaled like the scalar path.
+            __m128 lenSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_mul_ps(rz, rz));
+            __m128 inv = _mm_rsqrt_ps(lenSq);
+            inv = _mm_mul_ps(inv, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(half, lenSq), _mm_mul_ps(inv, inv))));
+            inv = SIMD::Select(_mm_cmpge_ps(lenSq, shortest), inv, one);
+
+            rx = _mm_mul_ps(rx, inv);
+            ry = _mm_mul_ps(ry, inv);
+            rz = _mm_mul_ps(rz, inv);
+
+            if (packed && lanes == 4)
+            {
+                __m128 a, b, c;
+                SIMD::Interleave3(rx, ry, rz, a, b, c);
+                float* dst = &dest[i].X;
+                _mm_storeu_ps(dst, a);
+                _mm_storeu_ps(dst + 4, b);
+                _mm_storeu_ps(dst + 8, c);
+            }
+            else
+            {
+                alignas(16) float sx[4], sy[4], sz[4];
+                _mm_store_ps(sx, rx);
+                _mm_store_ps(sy, ry);
+                _mm_store_ps(sz, rz);
+
+                for (ui32 k = 0; k < lanes; k++)
+                {
+                    StridedElement(dest, destStride, i + k) = Vector3(sx[k], sy[k], sz[k]);
+                }
+            }
+        }
+#else
+        for (ui32 i = 0; i < count; i++)
+        {
+            const Vector3& n = StridedElement(source, sourceStride, i);
+            Vector3 r(n.X*c11 + n.Y*c21 + n.Z*c31,
+                      n.X*c12 + n.Y*c22 + n.Z*c32,
+                      n.X*c13 + n.Y*c23 + n.Z*c33);
+
+            float lenSq = r.LengthSquared();
+            StridedElement(dest, destStride, i) = lenSq >= std::numeric_limits<float>::min() ? r * (1 / std::sqrt(lenSq)) : r;
+        }
+#endif
+    }
+
+    YAX_INLINE void Vector3::Transform(ExecutionPolicy policy, const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(sourceStride + destStride), [&](ui32 begin, ui32 end)
+        {
+            Transform(&StridedElement(source, sourceStride, begin), sourceStride, mat, &StridedElement(dest, destStride, begin), destStride, end - begin);
+        });
+    }
+
+    YAX_INLINE void Vector3::Transform(ExecutionPolicy policy, const Vector3* source, ui32 sourceStride, const Quaternion& q, Vector3* dest, ui32 destStride, ui32 count)
+    {
+        TransformNormal(policy, source, sourceStride, Matrix::CreateFromQuaternion(q), dest, destStride, count);
+    }
+
+    YAX_INLINE void Vector3::TransformNormal(ExecutionPolicy policy, const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(sourceStride + destStride), [&](ui32 begin, ui32 end)
+        {
+            TransformNormal(&StridedElement(source, sourceStride, begin), sourceStride, mat, &StridedElement(dest, destStride, begin), destStride, end - begin);
+        });
+    }
+
+    YAX_INLINE void Vector3::TransformSurfaceNormal(ExecutionPolicy policy, const Vector3* source, ui32 sourceStride, const Matrix& mat, Vector3* dest, ui32 destStride, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(sourceStride + destStride), [&](ui32 begin, ui32 end)
+        {
+            TransformSurfaceNormal(&StridedElement(source, sourceStride, begin), sourceStride, mat, &StridedElement(dest, destStride, begin), destStride, end - begin);
+        });
+    }
+
+    YAX_INLINE ui64 Vector3::TransformStream(const std::function<ui32(Vector3* buffer, ui32 capacity)>& reader, const Matrix& mat,
+                                             const std::function<void(const Vector3* buffer, ui32 count)>& writer,
+                                             ui32 chunkSize, ExecutionPolicy policy)
+    {
+        if (chunkSize == 0)
+            return 0;
+
+        //Chunk i lives in buffers[i % 3]: it is read while chunk i - 1 is transformed and chunk i - 2 is written
+        std::unique_ptr<Vector3[]> buffers[3];
+        for (auto& buffer : buffers)
+        {
+            buffer.reset(new Vector3[chunkSize]);
+        }
+
+        Matrix m = mat;
+        ui64 total = 0;
+
+        std::future<ui32> read = std::async(std::launch::async, reader, buffers[0].get(), chunkSize);
+        std::future<void> write;
+
+        for (ui32 i = 0;; i = (i + 1) % 3)
+        {
+            ui32 count = read.get();
+            if (count == 0)
+                break;
+
+            count = count < chunkSize ? count : chunkSize;
+            total += count;
+
+            //The next buffer was last used by the write two chunks ago, which finished before the previous write started
+            read = std::async(std::launch::async, reader, buffers[(i + 1) % 3].get(), chunkSize);
+
+            Vector3* chunk = buffers[i].get();
+            Transform(policy, chunk, sizeof(Vector3), m, chunk, sizeof(Vector3), count);
+
+            //Writes are kept in order by waiting for the previous one first
+            if (write.valid())
+                write.get();
+
+            write = std::async(std::launch::async, writer, chunk, count);
+        }
+
+        if (write.valid())
+            write.get();
+
+        return total;
+    }
+
+    YAX_INLINE Vector3& Vector3::operator+=(const Vector3& v)
+    {
+        this->X += v.X;
+        this->Y += v.Y;
+        this->Z += v.Z;
+        return *this;
+    }
+
+    YAX_INLINE Vector3& Vector3::operator-=(const Vector3& v)
+    {
+        this->X -= v.X;
+        this->Y -= v.Y; 
+        this->Z -= v.Z;
+        return *this;
+    }
+
+    YAX_INLINE Vector3& Vector3::operator*=(const Vector3& v)
+    {
+        this->X *= v.X;
+        this->Y *= v.Y;
+        this->Z *= v.Z;
+        return *this;
+    }
+
+    YAX_INLINE Vector3& Vector3::operator*=(float s)
+    {
+        this->X *= s;
+        this->Y *= s;
+        this->Z *= s;
+        return *this;
+    }
+
+    YAX_INLINE Vector3& Vector3::operator/=(const Vector3& v)
+    {
+        this->X /= v.X;
+        this->Y /= v.Y;
+        this->Z /= v.Z;
+        return *this;
+    }
+
+    YAX_INLINE Vector3& Vector3::operator/=(float s)
+    {
+        this->X /= s;
+        this->Y /= s;
+        this->Z /= s;
+        return *this;
+    }
+
+    YAX_INLINE Vector3 operator+(const Vector3& lhs, const Vector3& rhs)
+    {
+        return Vector3
+        (
+            lhs.X + rhs.X,
+            lhs.Y + rhs.Y,
+            lhs.Z + rhs.Z
+        );
+    }
+
+    YAX_INLINE Vector3 operator-(const Vector3& lhs, const Vector3& rhs)
+    {
+        return lhs + (-rhs);
+    }
+
+    YAX_INLINE Vector3 operator*(const Vector3& lhs, const Vector3& rhs)
+    {
+        return Vector3
+        (
+            lhs.X * rhs.X,
+            lhs.Y * rhs.Y,
+            lhs.Z * rhs.Z
+        );
+    }
+
+    YAX_INLINE Vector3 operator*(const Vector3& lhs, float rhs)
+    {
+        return Vector3
+        (
+            lhs.X * rhs,
+            lhs.Y * rhs,
+            lhs.Z * rhs
+        );
+    }
+
+    YAX_INLINE Vector3 operator*(float lhs, const Vector3& rhs)
+    {
+        return rhs * lhs;
+    }
+
+    YAX_INLINE Vector3 operator/(const Vector3& lhs, const Vector3& rhs)
+    {
+        return Vector3
+        (
+            lhs.X / rhs.X,
+            lhs.Y / rhs.Y,
+            lhs.Z / rhs.Z
+        );
+    }
+
+    YAX_INLINE Vector3 operator/(const Vector3& lhs, float rhs)
+    {
+        return Vector3
+        (
+            lhs.X / rhs,
+            lhs.Y / rhs,
+            lhs.Z / rhs
+        );
+    }
+
+    YAX_INLINE Vector3 operator-(const Vector3& rhs)
+    {
+        return Vector3
+        (
+            -rhs.X,
+            -rhs.Y,
+            -rhs.Z
+        );
+    }
+
+    YAX_INLINE bool operator==(const Vector3& lhs, const Vector3& rhs)
+    {
+        using MathHelper::EqualWithinEpsilon;
+
+        return (EqualWithinEpsilon(lhs.X, rhs.X) && 
+                EqualWithinEpsilon(lhs.Y, rhs.Y) && 
+                EqualWithinEpsilon(lhs.Z, rhs.Z));
+    }
+
+    YAX_INLINE bool operator!=(const Vector3& lhs, const Vector3& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    YAX_INLINE bool operator>(const Vector3& lhs, const Vector3& rhs)
+    {
+        return (lhs.X > rhs.X && lhs.Y > rhs.Y && lhs.Z > rhs.Z);
+    }
+
+    YAX_INLINE bool operator<(const Vector3& lhs, const Vector3& rhs)
+    {
+        return (lhs.X < rhs.X && lhs.Y < rhs.Y && lhs.Z < rhs.Z);
+    }
+
+    YAX_INLINE bool operator>=(const Vector3& lhs, const Vector3& rhs)
+    {
+        return (lhs.X >= rhs.X && lhs.Y >= rhs.Y && lhs.Z >= rhs.Z);
+    }
+
+    YAX_INLINE bool operator<=(const Vector3& lhs, const Vector3& rhs)
+    {
+        return (lhs.X <= rhs.X && lhs.Y <= rhs.Y && lhs.Z <= rhs.Z);
+    }
+}
+
@@ -0,0 +1,108 @@
+#ifndef _VEC3A_H
+#define _VEC3A_H
+
+#include "Parallel.h"
+#include "Utils.h"
+
+namespace YAX
+{
+    struct Vector3;
+    struct MatrixA;
+
+    /**
+    * @brief A 16-byte aligned Vector3, for storage that is fed to SIMD code
+    *
+    * The struct is padded to 16 bytes so it can be loaded and stored as a whole register.
+    * The padding is not part of the vector and its value is unspecified.
+    */
+    struct alignas(16) Vector3A
+    {
+        float X, Y, Z;
+
+        Vector3A() = default;
+        constexpr Vector3A(float x, float y, float z);
+        constexpr Vector3A(const Vector3& v);
+
+        constexpr operator Vector3() const;
+
+        /**
+        * @brief Calculates the cross product of two Vector3As
+        */
+        static Vector3A Cross(const Vector3A& v1, const Vector3A& v2);
+
+        /**
+        * @brief Calculates the dot product between two Vector3As
+        */
+        static float Dot(const Vector3A& v1, const Vector3A& v2);
+
+        /**
+        * @brief Transforms a Vector3A by a matrix
+        *
+        * @param v The vector to transform
+        * @param mat The transformation matrix
+        * @return The transformed Vector3A
+        */
+        static Vector3A Transform(const Vector3A& v, const MatrixA& mat);
+
+        /**
+        * @brief Transforms an array of Vector3As by a matrix
+        *
+        * @param source The array of Vector3As to transform
+        * @param mat The transformation matrix
+        * @param dest The array to store the transformed Vector3As in; may be the same array as source
+        * @param count The number of Vector3As to transform
+        */
+        static void Transform(const Vector3A* source, const MatrixA& mat, Vector3A* dest, ui32 count);
+
+        /**
+        * @brief Transforms an array of Vector3As by a matrix, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The array of Vector3As to transform
+        * @param mat The transformation matrix
+        * @param dest The array to store the transformed Vector3As in; may be the same array as source
+        * @param count The number of Vector3As to transform
+        */
+        static void Transform(ExecutionPolicy policy, const Vector3A* source, const MatrixA& mat, Vector3A* dest, ui32 count);
+
+        /**
+        * @brief Transforms a normal vector by a matrix without applying translation
+        *
+        * @param normal The Vector3A to transform
+        * @param mat The transformation matrix
+        * @return The transformed normal
+        */
+        static Vector3A TransformNormal(const Vector3A& normal, const MatrixA& mat);
+    };
+
+    Vector3A operator+(const Vector3A&, const Vector3A&);
+    Vector3A operator-(const Vector3A&, const Vector3A&);
+    Vector3A operator*(const Vector3A&, const Vector3A&);
+    Vector3A operator*(const Vector3A&, float);
+    Vector3A operator*(float, const Vector3A&);
+}
+
+//Included after the declarations above so that the headers can depend on each other
+#include "Vector3.h"
+
+namespace YAX
+{
+    constexpr Vector3A::Vector3A(float x, float y, float z)
+        : X(x), Y(y), Z(z)
+    {}
+
+    constexpr Vector3A::Vector3A(const Vector3& v)
+        : X(v.X), Y(v.Y), Z(v.Z)
+    {}
+
+    constexpr Vector3A::operator Vector3() const
+    {
+        return Vector3(X, Y, Z);
+    }
+}
+
+#ifdef YAX_MATH_INLINE
+#include "Vector3A.inl"
+#endif
+
+#endif
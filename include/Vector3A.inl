@@ -0,0 +1,132 @@
+#include "MatrixA.h"
+#include "SIMD.h"
+
+namespace YAX
+{
+    static_assert(sizeof(Vector3A) == 4 * sizeof(float), "Vector3A must be padded to a full register");
+
+#ifdef YAX_SSE
+    namespace Detail
+    {
+        YAX_INLINE Vector3A StoreVector3A(__m128 v)
+        {
+            Vector3A res;
+            _mm_store_ps(&res.X, v);
+            return res;
+        }
+    }
+#endif
+
+    YAX_INLINE Vector3A Vector3A::Cross(const Vector3A& v1, const Vector3A& v2)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector3A(SIMD::Cross3(_mm_load_ps(&v1.X), _mm_load_ps(&v2.X)));
+#else
+        return Vector3A(v1.Y*v2.Z - v1.Z*v2.Y,
+                        v1.Z*v2.X - v1.X*v2.Z,
+                        v1.X*v2.Y - v1.Y*v2.X);
+#endif
+    }
+
+    YAX_INLINE float Vector3A::Dot(const Vector3A& v1, const Vector3A& v2)
+    {
+#ifdef YAX_SSE
+        return _mm_cvtss_f32(SIMD::Dot3(_mm_load_ps(&v1.X), _mm_load_ps(&v2.X)));
+#else
+        return v1.X*v2.X + v1.Y*v2.Y + v1.Z*v2.Z;
+#endif
+    }
+
+    YAX_INLINE Vector3A Vector3A::Transform(const Vector3A& v, const MatrixA& mat)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector3A(SIMD::TransformPoint(_mm_load_ps(&v.X), _mm_load_ps(&mat.M11), _mm_load_ps(&mat.M21),
+                                                          _mm_load_ps(&mat.M31), _mm_load_ps(&mat.M41)));
+#else
+        return Vector3A(v.X*mat.M11 + v.Y*mat.M21 + v.Z*mat.M31 + mat.M41,
+                        v.X*mat.M12 + v.Y*mat.M22 + v.Z*mat.M32 + mat.M42,
+                        v.X*mat.M13 + v.Y*mat.M23 + v.Z*mat.M33 + mat.M43);
+#endif
+    }
+
+    YAX_INLINE void Vector3A::Transform(const Vector3A* source, const MatrixA& mat, Vector3A* dest, ui32 count)
+    {
+#ifdef YAX_SSE
+        __m128 b0 = _mm_load_ps(&mat.M11);
+        __m128 b1 = _mm_load_ps(&mat.M21);
+        __m128 b2 = _mm_load_ps(&mat.M31);
+        __m128 b3 = _mm_load_ps(&mat.M41);
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            _mm_store_ps(&dest[i].X, SIMD::TransformPoint(_mm_load_ps(&source[i].X), b0, b1, b2, b3));
+        }
+#else
+        for (ui32 i = 0; i < count; i++)
+        {
+            dest[i] = Transform(source[i], mat);
+        }
+#endif
+    }
+
+    YAX_INLINE void Vector3A::Transform(ExecutionPolicy policy, const Vector3A* source, const MatrixA& mat, Vector3A* dest, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(2 * sizeof(Vector3A)), [&](ui32 begin, ui32 end)
+        {
+            Transform(source + begin, mat, dest + begin, end - begin);
+        });
+    }
+
+    YAX_INLINE Vector3A Vector3A::TransformNormal(const Vector3A& norm, const MatrixA& mat)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector3A(SIMD::TransformDirection(_mm_load_ps(&norm.X), _mm_load_ps(&mat.M11),
+                                                              _mm_load_ps(&mat.M21), _mm_load_ps(&mat.M31)));
+#else
+        return Vector3A(norm.X*mat.M11 + norm.Y*mat.M21 + norm.Z*mat.M31,
+                        norm.X*mat.M12 + norm.Y*mat.M22 + norm.Z*mat.M32,
+                        norm.X*mat.M13 + norm.Y*mat.M23 + norm.Z*mat.M33);
+#endif
+    }
+
+    YAX_INLINE Vector3A operator+(const Vector3A& lhs, const Vector3A& rhs)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector3A(_mm_add_ps(_mm_load_ps(&lhs.X), _mm_load_ps(&rhs.X)));
+#else
+        return Vector3A(lhs.X + rhs.X, lhs.Y + rhs.Y, lhs.Z + rhs.Z);
+#endif
+    }
+
+    YAX_INLINE Vector3A operator-(const Vector3A& lhs, const Vector3A& rhs)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector3A(_mm_sub_ps(_mm_load_ps(&lhs.X), _mm_load_ps(&rhs.X)));
+#else
+        return Vector3A(lhs.X - rhs.X, lhs.Y - rhs.Y, lhs.Z - rhs.Z);
+#endif
+    }
+
+    YAX_INLINE Vector3A operator*(const Vector3A& lhs, const Vector3A& rhs)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector3A(_mm_mul_ps(_mm_load_ps(&lhs.X), _mm_load_ps(&rhs.X)));
+#else
+        return Vector3A(lhs.X * rhs.X, lhs.Y * rhs.Y, lhs.Z * rhs.Z);
+#endif
+    }
+
+    YAX_INLINE Vector3A operator*(const Vector3A& lhs, float rhs)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector3A(_mm_mul_ps(_mm_load_ps(&lhs.X), _mm_set1_ps(rhs)));
+#else
+        return Vector3A(lhs.X * rhs, lhs.Y * rhs, lhs.Z * rhs);
+#endif
+    }
+
+    YAX_INLINE Vector3A operator*(float lhs, const Vector3A& rhs)
+    {
+        return rhs * lhs;
+    }
+}
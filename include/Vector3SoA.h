@@ -0,0 +1,180 @@
+#ifndef _VEC3SOA_H
+#define _VEC3SOA_H
+
+#include "Parallel.h"
+#include "SoAStorage.h"
+#include "Utils.h"
+
+namespace YAX
+{
+    struct Matrix;
+    struct Vector3;
+
+    /**
+    * @brief A structure-of-arrays container of Vector3s, with each component stored in its own array
+    *
+    * Every component array is 32-byte aligned and padded to a multiple of Width floats, so SIMD code can
+    * process whole registers without a scalar tail. The padding lanes are not part of the container and their
+    * values are unspecified. The component arrays may be modified directly through X(), Y() and Z().
+    */
+    struct Vector3SoA
+    {
+        //The number of floats every component array is padded to a multiple of; one AVX register
+        static constexpr ui32 Width = Detail::SoAStorage<3>::Width;
+
+        Vector3SoA();
+        explicit Vector3SoA(ui32 count);
+
+        /**
+        * @brief Creates a container holding a copy of an array of Vector3s
+        */
+        Vector3SoA(const Vector3* source, ui32 count);
+
+        /**
+        * @brief Gets the number of Vector3s in the container
+        */
+        ui32 Size() const;
+
+        /**
+        * @brief Gets the length of each component array, including padding
+        */
+        ui32 PaddedSize() const;
+
+        /**
+        * @brief Changes the number of Vector3s in the container, keeping the existing ones and zeroing new ones
+        */
+        void Resize(ui32 count);
+
+        float* X();
+        float* Y();
+        float* Z();
+        const float* X() const;
+        const float* Y() const;
+        const float* Z() const;
+
+        Vector3 Get(ui32 index) const;
+        void Set(ui32 index, const Vector3& v);
+
+        /**
+        * @brief Replaces the contents of the container with an array of Vector3s
+        *
+        * @param source The array of Vector3s to copy
+        * @param count The number of Vector3s to copy; the container is resized to hold exactly this many
+        */
+        void CopyFrom(const Vector3* source, ui32 count);
+
+        /**
+        * @brief Copies the contents of the container into an array of Vector3s
+        *
+        * @param dest The array to copy into; must hold at least Size() Vector3s
+        */
+        void CopyTo(Vector3* dest) const;
+
+        /**
+        * @brief Calculates the cross products of two containers of Vector3s
+        *
+        * @param v1, v2 The containers of Vector3s; must be the same size
+        * @param dest The container to store the cross products in; may be the same as v1 or v2
+        */
+        static void Cross(const Vector3SoA& v1, const Vector3SoA& v2, Vector3SoA& dest);
+
+        /**
+        * @brief Calculates the squared distances between two containers of points
+        *
+        * @param p1, p2 The containers of points; must be the same size
+        * @param dest The array to store the squared distances in; must hold at least p1.Size() floats
+        */
+        static void DistanceSquared(const Vector3SoA& p1, const Vector3SoA& p2, float* dest);
+
+        /**
+        * @brief Calculates the dot products of two containers of Vector3s
+        *
+        * @param v1, v2 The containers of Vector3s; must be the same size
+        * @param dest The array to store the dot products in; must hold at least v1.Size() floats
+        */
+        static void Dot(const Vector3SoA& v1, const Vector3SoA& v2, float* dest);
+
+        /**
+        * @brief Linearly interpolates between two containers of Vector3s
+        *
+        * @param v1 The start (t = 0) Vector3s
+        * @param v2 The end (t = 1) Vector3s; must be the same size as v1
+        * @param t The interpolation amount
+        * @param dest The container to store the interpolated Vector3s in; may be the same as v1 or v2
+        */
+        static void Lerp(const Vector3SoA& v1, const Vector3SoA& v2, float t, Vector3SoA& dest);
+
+        /**
+        * @brief Finds the componentwise maximums of two containers of Vector3s
+        *
+        * @param v1, v2 The containers of Vector3s; must be the same size
+        * @param dest The container to store the maximums in; may be the same as v1 or v2
+        */
+        static void Max(const Vector3SoA& v1, const Vector3SoA& v2, Vector3SoA& dest);
+
+        /**
+        * @brief Finds the componentwise minimums of two containers of Vector3s
+        *
+        * @param v1, v2 The containers of Vector3s; must be the same size
+        * @param dest The container to store the minimums in; may be the same as v1 or v2
+        */
+        static void Min(const Vector3SoA& v1, const Vector3SoA& v2, Vector3SoA& dest);
+
+        /**
+        * @brief Normalizes every Vector3 in a container
+        *
+        * @param source The Vector3s to normalize
+        * @param dest The container to store the normalized Vector3s in; may be the same as source
+        */
+        static void Normalize(const Vector3SoA& source, Vector3SoA& dest);
+
+        /**
+        * @brief Transforms every Vector3 in a container by a matrix
+        *
+        * @param source The Vector3s to transform
+        * @param mat The transformation matrix
+        * @param dest The container to store the transformed Vector3s in; may be the same as source
+        */
+        static void Transform(const Vector3SoA& source, const Matrix& mat, Vector3SoA& dest);
+
+        /**
+        * @brief Transforms every Vector3 in a container by a matrix, spreading the work across threads
+        *
+        * Each thread gets a run of whole SIMD registers, so the results match the sequential overload.
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The Vector3s to transform
+        * @param mat The transformation matrix
+        * @param dest The container to store the transformed Vector3s in; may be the same as source
+        */
+        static void Transform(ExecutionPolicy policy, const Vector3SoA& source, const Matrix& mat, Vector3SoA& dest);
+
+        /**
+        * @brief Transforms every normal in a container by a matrix without applying translation
+        *
+        * @param source The normals to transform
+        * @param mat The transformation matrix
+        * @param dest The container to store the transformed normals in; may be the same as source
+        */
+        static void TransformNormal(const Vector3SoA& source, const Matrix& mat, Vector3SoA& dest);
+
+        /**
+        * @brief Transforms every normal in a container by a matrix without applying translation, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The normals to transform
+        * @param mat The transformation matrix
+        * @param dest The container to store the transformed normals in; may be the same as source
+        */
+        static void TransformNormal(ExecutionPolicy policy, const Vector3SoA& source, const Matrix& mat, Vector3SoA& dest);
+
+    private:
+        Detail::SoAStorage<3> storage;
+    };
+}
+
+#ifdef YAX_MATH_INLINE
+#include "Vector3SoA.inl"
+#endif
+
+#endif
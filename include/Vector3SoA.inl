@@ -0,0 +1,368 @@
+#include <cmath>
+#include "Matrix.h"
+#include "SIMD.h"
+#include "Vector3.h"
+
+namespace YAX
+{
+    namespace Detail
+    {
+#if defined(YAX_SSE)
+        //The AVX branch of TransformLanes, a whole Width (one register) at a time. Compiled for AVX even when the rest of
+        //the library isn't; only call it if SIMD::SupportsAVX()
+        YAX_INLINE YAX_TARGET_AVX void TransformLanesAVX(const float* sx, const float* sy, const float* sz, const Matrix& m, float* x, float* y, float* z, ui32 count, bool translate)
+        {
+            __m256 m11 = _mm256_set1_ps(m.M11), m12 = _mm256_set1_ps(m.M12), m13 = _mm256_set1_ps(m.M13);
+            __m256 m21 = _mm256_set1_ps(m.M21), m22 = _mm256_set1_ps(m.M22), m23 = _mm256_set1_ps(m.M23);
+            __m256 m31 = _mm256_set1_ps(m.M31), m32 = _mm256_set1_ps(m.M32), m33 = _mm256_set1_ps(m.M33);
+            __m256 m41 = _mm256_set1_ps(m.M41), m42 = _mm256_set1_ps(m.M42), m43 = _mm256_set1_ps(m.M43);
+
+            for (ui32 i = 0; i < count; i += 8)
+            {
+                __m256 vx = _mm256_load_ps(sx + i), vy = _mm256_load_ps(sy + i), vz = _mm256_load_ps(sz + i);
+                __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m11), _mm256_mul_ps(vy, m21)), _mm256_mul_ps(vz, m31));
+                __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m12), _mm256_mul_ps(vy, m22)), _mm256_mul_ps(vz, m32));
+                __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m13), _mm256_mul_ps(vy, m23)), _mm256_mul_ps(vz, m33));
+
+                if (translate)
+                {
+                    rx = _mm256_add_ps(rx, m41);
+                    ry = _mm256_add_ps(ry, m42);
+                    rz = _mm256_add_ps(rz, m43);
+                }
+
+                _mm256_store_ps(x + i, rx);
+                _mm256_store_ps(y + i, ry);
+                _mm256_store_ps(z + i, rz);
+            }
+        }
+#endif
+
+        //Transforms the component arrays of a Vector3SoA, summing the products in the same order as Vector3::Transform
+        YAX_INLINE void TransformLanes(const float* sx, const float* sy, const float* sz, const Matrix& m, float* x, float* y, float* z, ui32 count, bool translate)
+        {
+#if defined(YAX_SSE)
+            if (SIMD::SupportsAVX())
+            {
+                TransformLanesAVX(sx, sy, sz, m, x, y, z, count, translate);
+                return;
+            }
+
+            __m128 m11 = _mm_set1_ps(m.M11), m12 = _mm_set1_ps(m.M12), m13 = _mm_set1_ps(m.M13);
+            __m128 m21 = _mm_set1_ps(m.M21), m22 = _mm_set1_ps(m.M22), m23 = _mm_set1_ps(m.M23);
+            __m128 m31 = _mm_set1_ps(m.M31), m32 = _mm_set1_ps(m.M32), m33 = _mm_set1_ps(m.M33);
+            __m128 m41 = _mm_set1_ps(m.M41), m42 = _mm_set1_ps(m.M42), m43 = _mm_set1_ps(m.M43);
+
+            for (ui32 i = 0; i < count; i += 4)
+            {
+                __m128 vx = _mm_load_ps(sx + i), vy = _mm_load_ps(sy + i), vz = _mm_load_ps(sz + i);
+                __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m11), _mm_mul_ps(vy, m21)), _mm_mul_ps(vz, m31));
+                __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m12), _mm_mul_ps(vy, m22)), _mm_mul_ps(vz, m32));
+                __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m13), _mm_mul_ps(vy, m23)), _mm_mul_ps(vz, m33));
+
+                if (translate)
+                {
+                    rx = _mm_add_ps(rx, m41);
+                    ry = _mm_add_ps(ry, m42);
+                    rz = _mm_add_ps(rz, m43);
+                }
+
+                _mm_store_ps(x + i, rx);
+                _mm_store_ps(y + i, ry);
+                _mm_store_ps(z + i, rz);
+            }
+#else
+            for (ui32 i = 0; i < count; i++)
+            {
+                Vector3 v(sx[i], sy[i], sz[i]);
+                Vector3 r = translate ? Vector3::Transform(v, m) : Vector3::TransformNormal(v, m);
+                x[i] = r.X;
+                y[i] = r.Y;
+                z[i] = r.Z;
+            }
+#endif
+        }
+
+        //Splits TransformLanes across threads in blocks of whole SIMD registers
+        YAX_INLINE void TransformLanes(ExecutionPolicy policy, const Vector3SoA& source, const Matrix& m, Vector3SoA& dest, bool translate)
+        {
+            static_assert(Parallel::BlockSize(6 * sizeof(float)) % Vector3SoA::Width == 0, "Blocks must start on a whole number of SIMD lanes");
+
+            dest.Resize(source.Size());
+
+            Parallel::For(policy, dest.PaddedSize(), Parallel::BlockSize(6 * sizeof(float)), [&](ui32 begin, ui32 end)
+            {
+                TransformLanes(source.X() + begin, source.Y() + begin, source.Z() + begin, m,
+                               dest.X() + begin, dest.Y() + begin, dest.Z() + begin, end - begin, translate);
+            });
+        }
+    }
+
+    YAX_INLINE Vector3SoA::Vector3SoA()
+    {}
+
+    YAX_INLINE Vector3SoA::Vector3SoA(ui32 count)
+    {
+        Resize(count);
+    }
+
+    YAX_INLINE Vector3SoA::Vector3SoA(const Vector3* source, ui32 count)
+    {
+        CopyFrom(source, count);
+    }
+
+    YAX_INLINE ui32 Vector3SoA::Size() const
+    {
+        return storage.Size();
+    }
+
+    YAX_INLINE ui32 Vector3SoA::PaddedSize() const
+    {
+        return storage.PaddedSize();
+    }
+
+    YAX_INLINE void Vector3SoA::Resize(ui32 count)
+    {
+        storage.Resize(count);
+    }
+
+    YAX_INLINE float* Vector3SoA::X()
+    {
+        return storage.Component(0);
+    }
+
+    YAX_INLINE float* Vector3SoA::Y()
+    {
+        return storage.Component(1);
+    }
+
+    YAX_INLINE float* Vector3SoA::Z()
+    {
+        return storage.Component(2);
+    }
+
+    YAX_INLINE const float* Vector3SoA::X() const
+    {
+        return storage.Component(0);
+    }
+
+    YAX_INLINE const float* Vector3SoA::Y() const
+    {
+        return storage.Component(1);
+    }
+
+    YAX_INLINE const float* Vector3SoA::Z() const
+    {
+        return storage.Component(2);
+    }
+
+    YAX_INLINE Vector3 Vector3SoA::Get(ui32 index) const
+    {
+        return Vector3(X()[index], Y()[index], Z()[index]);
+    }
+
+    YAX_INLINE void Vector3SoA::Set(ui32 index, const Vector3& v)
+    {
+        X()[index] = v.X;
+        Y()[index] = v.Y;
+        Z()[index] = v.Z;
+    }
+
+    YAX_INLINE void Vector3SoA::CopyFrom(const Vector3* source, ui32 count)
+    {
+        Resize(count);
+
+        float* x = X();
+        float* y = Y();
+        float* z = Z();
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        const float* src = &source->X;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 vx, vy, vz;
+            SIMD::Deinterleave3(_mm_loadu_ps(src + 3 * i), _mm_loadu_ps(src + 3 * i + 4), _mm_loadu_ps(src + 3 * i + 8), vx, vy, vz);
+            _mm_store_ps(x + i, vx);
+            _mm_store_ps(y + i, vy);
+            _mm_store_ps(z + i, vz);
+        }
+#endif
+        for (; i < count; i++)
+        {
+            x[i] = source[i].X;
+            y[i] = source[i].Y;
+            z[i] = source[i].Z;
+        }
+    }
+
+    YAX_INLINE void Vector3SoA::CopyTo(Vector3* dest) const
+    {
+        const float* x = X();
+        const float* y = Y();
+        const float* z = Z();
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        float* dst = &dest->X;
+
+        for (; i + 4 <= Size(); i += 4)
+        {
+            __m128 a, b, c;
+            SIMD::Interleave3(_mm_load_ps(x + i), _mm_load_ps(y + i), _mm_load_ps(z + i), a, b, c);
+            _mm_storeu_ps(dst + 3 * i, a);
+            _mm_storeu_ps(dst + 3 * i + 4, b);
+            _mm_storeu_ps(dst + 3 * i + 8, c);
+        }
+#endif
+        for (; i < Size(); i++)
+        {
+            dest[i] = Vector3(x[i], y[i], z[i]);
+        }
+    }
+
+    YAX_INLINE void Vector3SoA::Cross(const Vector3SoA& v1, const Vector3SoA& v2, Vector3SoA& dest)
+    {
+        dest.Resize(v1.Size());
+
+        const float *x1 = v1.X(), *y1 = v1.Y(), *z1 = v1.Z();
+        const float *x2 = v2.X(), *y2 = v2.Y(), *z2 = v2.Z();
+        float *x = dest.X(), *y = dest.Y(), *z = dest.Z();
+        ui32 n = dest.PaddedSize();
+
+#ifdef YAX_SSE
+        for (ui32 i = 0; i < n; i += 4)
+        {
+            __m128 ax = _mm_load_ps(x1 + i), ay = _mm_load_ps(y1 + i), az = _mm_load_ps(z1 + i);
+            __m128 bx = _mm_load_ps(x2 + i), by = _mm_load_ps(y2 + i), bz = _mm_load_ps(z2 + i);
+            _mm_store_ps(x + i, _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+            _mm_store_ps(y + i, _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)));
+            _mm_store_ps(z + i, _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+        }
+#else
+        for (ui32 i = 0; i < n; i++)
+        {
+            float cx = y1[i]*z2[i] - z1[i]*y2[i];
+            float cy = z1[i]*x2[i] - x1[i]*z2[i];
+            float cz = x1[i]*y2[i] - y1[i]*x2[i];
+            x[i] = cx;
+            y[i] = cy;
+            z[i] = cz;
+        }
+#endif
+    }
+
+    YAX_INLINE void Vector3SoA::DistanceSquared(const Vector3SoA& p1, const Vector3SoA& p2, float* dest)
+    {
+        const float *x1 = p1.X(), *y1 = p1.Y(), *z1 = p1.Z();
+        const float *x2 = p2.X(), *y2 = p2.Y(), *z2 = p2.Z();
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        for (; i + 4 <= p1.Size(); i += 4)
+        {
+            __m128 dx = _mm_sub_ps(_mm_load_ps(x1 + i), _mm_load_ps(x2 + i));
+            __m128 dy = _mm_sub_ps(_mm_load_ps(y1 + i), _mm_load_ps(y2 + i));
+            __m128 dz = _mm_sub_ps(_mm_load_ps(z1 + i), _mm_load_ps(z2 + i));
+            _mm_storeu_ps(dest + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+        }
+#endif
+        for (; i < p1.Size(); i++)
+        {
+            float dx = x1[i] - x2[i];
+            float dy = y1[i] - y2[i];
+            float dz = z1[i] - z2[i];
+            dest[i] = dx*dx + dy*dy + dz*dz;
+        }
+    }
+
+    YAX_INLINE void Vector3SoA::Dot(const Vector3SoA& v1, const Vector3SoA& v2, float* dest)
+    {
+        const float *x1 = v1.X(), *y1 = v1.Y(), *z1 = v1.Z();
+        const float *x2 = v2.X(), *y2 = v2.Y(), *z2 = v2.Z();
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        for (; i + 4 <= v1.Size(); i += 4)
+        {
+            __m128 xx = _mm_mul_ps(_mm_load_ps(x1 + i), _mm_load_ps(x2 + i));
+            __m128 yy = _mm_mul_ps(_mm_load_ps(y1 + i), _mm_load_ps(y2 + i));
+            __m128 zz = _mm_mul_ps(_mm_load_ps(z1 + i), _mm_load_ps(z2 + i));
+            _mm_storeu_ps(dest + i, _mm_add_ps(_mm_add_ps(xx, yy), zz));
+        }
+#endif
+        for (; i < v1.Size(); i++)
+        {
+            dest[i] = x1[i]*x2[i] + y1[i]*y2[i] + z1[i]*z2[i];
+        }
+    }
+
+    YAX_INLINE void Vector3SoA::Lerp(const Vector3SoA& v1, const Vector3SoA& v2, float t, Vector3SoA& dest)
+    {
+        dest.Resize(v1.Size());
+        Detail::LerpLanes(v1.storage.Lanes(), v2.storage.Lanes(), t, dest.storage.Lanes(), dest.storage.LaneCount());
+    }
+
+    YAX_INLINE void Vector3SoA::Max(const Vector3SoA& v1, const Vector3SoA& v2, Vector3SoA& dest)
+    {
+        dest.Resize(v1.Size());
+        Detail::MaxLanes(v1.storage.Lanes(), v2.storage.Lanes(), dest.storage.Lanes(), dest.storage.LaneCount());
+    }
+
+    YAX_INLINE void Vector3SoA::Min(const Vector3SoA& v1, const Vector3SoA& v2, Vector3SoA& dest)
+    {
+        dest.Resize(v1.Size());
+        Detail::MinLanes(v1.storage.Lanes(), v2.storage.Lanes(), dest.storage.Lanes(), dest.storage.LaneCount());
+    }
+
+    YAX_INLINE void Vector3SoA::Normalize(const Vector3SoA& source, Vector3SoA& dest)
+    {
+        dest.Resize(source.Size());
+
+        const float *sx = source.X(), *sy = source.Y(), *sz = source.Z();
+        float *x = dest.X(), *y = dest.Y(), *z = dest.Z();
+        ui32 n = dest.PaddedSize();
+
+#ifdef YAX_SSE
+        for (ui32 i = 0; i < n; i += 4)
+        {
+            __m128 vx = _mm_load_ps(sx + i), vy = _mm_load_ps(sy + i), vz = _mm_load_ps(sz + i);
+            __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz)));
+            _mm_store_ps(x + i, _mm_div_ps(vx, len));
+            _mm_store_ps(y + i, _mm_div_ps(vy, len));
+            _mm_store_ps(z + i, _mm_div_ps(vz, len));
+        }
+#else
+        for (ui32 i = 0; i < n; i++)
+        {
+            float len = std::sqrt(sx[i]*sx[i] + sy[i]*sy[i] + sz[i]*sz[i]);
+            x[i] = sx[i] / len;
+            y[i] = sy[i] / len;
+            z[i] = sz[i] / len;
+        }
+#endif
+    }
+
+    YAX_INLINE void Vector3SoA::Transform(const Vector3SoA& source, const Matrix& mat, Vector3SoA& dest)
+    {
+        dest.Resize(source.Size());
+        Detail::TransformLanes(source.X(), source.Y(), source.Z(), mat, dest.X(), dest.Y(), dest.Z(), dest.PaddedSize(), true);
+    }
+
+    YAX_INLINE void Vector3SoA::TransformNormal(const Vector3SoA& source, const Matrix& mat, Vector3SoA& dest)
+    {
+        dest.Resize(source.Size());
+        Detail::TransformLanes(source.X(), source.Y(), source.Z(), mat, dest.X(), dest.Y(), dest.Z(), dest.PaddedSize(), false);
+    }
+
+    YAX_INLINE void Vector3SoA::Transform(ExecutionPolicy policy, const Vector3SoA& source, const Matrix& mat, Vector3SoA& dest)
+    {
+        Detail::TransformLanes(policy, source, mat, dest, true);
+    }
+
+    YAX_INLINE void Vector3SoA::TransformNormal(ExecutionPolicy policy, const Vector3SoA& source, const Matrix& mat, Vector3SoA& dest)
+    {
+        Detail::TransformLanes(policy, source, mat, dest, false);
+    }
+}
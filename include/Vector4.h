@@ -2,6 +2,7 @@
 #define _VEC4_H
 
 #include <vector>
+#include "Parallel.h"
 #include "Utils.h"
 
 namespace YAX
@@ -11,17 +12,31 @@ namespace YAX
     struct Matrix;
     struct Quaternion;
 
+    template <typename E>
+    struct MatrixExpression;
+
+    //Bits of the outcodes written by Vector4::Project, one for each clip-space plane a point is outside of
+    namespace Outcode
+    {
+        constexpr ui8 Left = 1 << 0;    //x < -w
+        constexpr ui8 Right = 1 << 1;   //x > w
+        constexpr ui8 Bottom = 1 << 2;  //y < -w
+        constexpr ui8 Top = 1 << 3;     //y > w
+        constexpr ui8 Near = 1 << 4;    //z < 0
+        constexpr ui8 Far = 1 << 5;     //z > w
+    }
+
     struct Vector4
     {
         static const Vector4 One, UnitX, UnitY, UnitZ, UnitW, Zero;
         
         float X, Y, Z, W;
         
-        Vector4();
-        Vector4(float val);
-        Vector4(float x, float y, float z, float w);
-        Vector4(Vector2 xy, float z, float w);
-        Vector4(Vector3 xyz, float w);
+        constexpr Vector4();
+        constexpr Vector4(float val);
+        constexpr Vector4(float x, float y, float z, float w);
+        constexpr Vector4(Vector2 xy, float z, float w);
+        constexpr Vector4(Vector3 xyz, float w);
 
         /**
         * @brief Normalizes the vector, maintaining direction but reducing its length to 1
@@ -150,6 +165,18 @@ namespace YAX
         */
         static Vector4 Transform(const Vector4& v, const Matrix& m);
 
+        /**
+        * @brief Transforms a Vector4 by a lazy matrix product (see MatrixExpression.h)
+        *
+        * The vector is carried through each matrix in turn, so no intermediate matrix product is ever formed.
+        *
+        * @param v The vector to transform
+        * @param mat The matrix product expression
+        * @return The transformed Vector4
+        */
+        template <typename E>
+        static Vector4 Transform(const Vector4& v, const MatrixExpression<E>& mat);
+
         /**
         * @brief Rotates a Vector4 by a quaternion
         *
@@ -231,6 +258,104 @@ namespace YAX
         */
         static void TransformNormal(const std::vector<Vector4>& source, const Matrix& mat, std::vector<Vector4>& dest);
 
+        /**
+        * @brief Transforms an array of Vector4s by a matrix
+        *
+        * The strides let the Vector4s be members of larger structs, e.g. the positions of interleaved vertices,
+        * so they can be transformed in place without copying them out.
+        *
+        * @param source The first Vector4 to transform
+        * @param sourceStride The distance in bytes between consecutive Vector4s in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector4 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector4s in dest
+        * @param count The number of Vector4s to transform
+        */
+        static void Transform(const Vector4* source, ui32 sourceStride, const Matrix& mat, Vector4* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Rotates an array of Vector4s by a quaternion
+        *
+        * @param source The first Vector4 to rotate
+        * @param sourceStride The distance in bytes between consecutive Vector4s in source
+        * @param q The quaternion to apply
+        * @param dest The first Vector4 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector4s in dest
+        * @param count The number of Vector4s to rotate
+        */
+        static void Transform(const Vector4* source, ui32 sourceStride, const Quaternion& q, Vector4* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of normals by a matrix without applying translation
+        *
+        * @param source The first normal to transform
+        * @param sourceStride The distance in bytes between consecutive normals in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector4 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector4s in dest
+        * @param count The number of normals to transform
+        */
+        static void TransformNormal(const Vector4* source, ui32 sourceStride, const Matrix& mat, Vector4* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of Vector4s by a matrix, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The first Vector4 to transform
+        * @param sourceStride The distance in bytes between consecutive Vector4s in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector4 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector4s in dest
+        * @param count The number of Vector4s to transform
+        */
+        static void Transform(ExecutionPolicy policy, const Vector4* source, ui32 sourceStride, const Matrix& mat, Vector4* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Rotates an array of Vector4s by a quaternion, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The first Vector4 to rotate
+        * @param sourceStride The distance in bytes between consecutive Vector4s in source
+        * @param q The quaternion to apply
+        * @param dest The first Vector4 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector4s in dest
+        * @param count The number of Vector4s to rotate
+        */
+        static void Transform(ExecutionPolicy policy, const Vector4* source, ui32 sourceStride, const Quaternion& q, Vector4* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Transforms an array of normals by a matrix without applying translation, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The first normal to transform
+        * @param sourceStride The distance in bytes between consecutive normals in source
+        * @param mat The transformation matrix
+        * @param dest The first Vector4 to store the results in; may be the same as source
+        * @param destStride The distance in bytes between consecutive Vector4s in dest
+        * @param count The number of normals to transform
+        */
+        static void TransformNormal(ExecutionPolicy policy, const Vector4* source, ui32 sourceStride, const Matrix& mat, Vector4* dest, ui32 destStride, ui32 count);
+
+        /**
+        * @brief Projects an array of points to screen space in a single pass
+        *
+        * Each point is transformed to clip space, divided by w and mapped to the viewport the same way as XNA's Viewport.Project.
+        * Points with a nonzero outcode lie outside the view frustum; their screen coordinates are unreliable if they lie
+        * behind the camera (w <= 0).
+        *
+        * @param source The array of points to project, usually with w = 1
+        * @param viewProjection The combined view and projection matrix (and world matrix, if the points are in object space)
+        * @param x, y The top-left corner of the viewport in pixels
+        * @param width, height The size of the viewport in pixels
+        * @param minDepth, maxDepth The depth range of the viewport
+        * @param dest The array to store the screen-space points in, as (x, y, depth)
+        * @param outcodes Optional output array for the Outcode bits of each point; Pass nullptr if not needed
+        * @param count The number of points to project
+        */
+        static void Project(const Vector4* source, const Matrix& viewProjection,
+                            float x, float y, float width, float height, float minDepth, float maxDepth,
+                            Vector3* dest, ui8* outcodes, ui32 count);
+
         Vector4& operator+=(const Vector4&);
         Vector4& operator-=(const Vector4&);
         Vector4& operator*=(const Vector4&);
@@ -253,5 +378,42 @@ namespace YAX
     bool operator!=(const Vector4&, const Vector4&);
 }
 
+//Included after the declarations above so that the headers can depend on each other
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace YAX
+{
+    constexpr Vector4::Vector4()
+        : Vector4(0.0f)
+    {}
+
+    constexpr Vector4::Vector4(float v)
+        : X(v), Y(v), Z(v), W(v)
+    {}
+
+    constexpr Vector4::Vector4(float x, float y, float z, float w)
+        : X(x), Y(y), Z(z), W(w)
+    {}
+
+    constexpr Vector4::Vector4(Vector2 xy, float z, float w)
+        : Vector4(xy.X, xy.Y, z, w)
+    {}
+
+    constexpr Vector4::Vector4(Vector3 xyz, float w)
+        : Vector4(xyz.X, xyz.Y, xyz.Z, w)
+    {}
+
+    constexpr Vector4 Vector4::One = Vector4(1.0f, 1.0f, 1.0f, 1.0f);
+    constexpr Vector4 Vector4::UnitX = Vector4(1.0f, 0.0f, 0.0f, 0.0f);
+    constexpr Vector4 Vector4::UnitY = Vector4(0.0f, 1.0f, 0.0f, 0.0f);
+    constexpr Vector4 Vector4::UnitZ = Vector4(0.0f, 0.0f, 1.0f, 0.0f);
+    constexpr Vector4 Vector4::UnitW = Vector4(0.0f, 0.0f, 0.0f, 1.0f);
+    constexpr Vector4 Vector4::Zero = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+}
+
+#ifdef YAX_MATH_INLINE
+#include "Vector4.inl"
+#endif
 
-#endif
\ No newline at end of file
+#endif
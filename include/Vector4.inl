@@ -0,0 +1,430 @@
+#include <cmath>
+#include "Matrix.h"
+#include "MathHelper.h"
+#include "Quaternion.h"
+#include "SIMD.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace YAX
+{
+    YAX_INLINE void Vector4::Normalize()
+    {
+        *this /= this->Length();
+    }
+
+    YAX_INLINE float Vector4::Length()
+    {
+        return std::sqrt(LengthSquared());
+    }
+
+    YAX_INLINE float Vector4::LengthSquared()
+    {
+        return X*X + Y*Y + Z*Z + W*W;
+    }
+
+    YAX_INLINE Vector4 Vector4::Barycentric(const Vector4& p1, const Vector4& p2, const Vector4& p3, float b2, float b3)
+    {
+        return (1 - b2 - b3)*p1 + b2*p2 + b3*p3;
+    }
+
+    YAX_INLINE Vector4 Vector4::CatmullRom(const Vector4& p1, const Vector4& p2, const Vector4& p3, const Vector4& p4, float t)
+    {
+        return Vector4(MathHelper::CatmullRom(p1.X, p2.X, p3.X, p4.X, t),
+                       MathHelper::CatmullRom(p1.Y, p2.Y, p3.Y, p4.Y, t),
+                       MathHelper::CatmullRom(p1.Z, p2.Z, p3.Z, p4.Z, t),
+                       MathHelper::CatmullRom(p1.W, p2.W, p3.W, p4.W, t));
+    }
+
+    YAX_INLINE Vector4 Vector4::Clamp(const Vector4& val, const Vector4& min, const Vector4& max)
+    {
+        return Vector4(MathHelper::Clamp(val.X, min.X, max.X),
+                       MathHelper::Clamp(val.X, min.X, max.X),
+                       MathHelper::Clamp(val.X, min.X, max.X),
+                       MathHelper::Clamp(val.X, min.X, max.X));
+    }
+
+    YAX_INLINE float Vector4::Distance(const Vector4& p1, const Vector4& p2)
+    {
+        return std::sqrt(DistanceSquared(p1, p2));
+    }
+
+    YAX_INLINE float Vector4::DistanceSquared(const Vector4& p1, const Vector4& p2)
+    {
+        return (p1 - p2).LengthSquared();
+    }
+
+    YAX_INLINE float Vector4::Dot(const Vector4& v1, const Vector4& v2)
+    {
+        return (v1.X*v2.X + v1.Y*v2.Y + v1.Z*v2.Z + v1.W*v2.W);
+    }
+
+    YAX_INLINE Vector4 Vector4::Hermite(const Vector4& p1, const Vector4& t1, const Vector4& p2, const Vector4& t2, float amt)
+    {
+        return Vector4(MathHelper::Hermite(p1.X, t1.X, p2.X, t2.X, amt),
+                       MathHelper::Hermite(p1.Y, t1.Y, p2.Y, t2.Y, amt),
+                       MathHelper::Hermite(p1.Z, t1.Z, p2.Z, t2.Z, amt),
+                       MathHelper::Hermite(p1.W, t1.W, p2.W, t2.W, amt));
+    }
+
+    YAX_INLINE Vector4 Vector4::Lerp(const Vector4& f, const Vector4& to, float t)
+    {
+        return Vector4(MathHelper::Lerp(f.X, to.X, t),
+                       MathHelper::Lerp(f.Y, to.Y, t),
+                       MathHelper::Lerp(f.Z, to.Z, t),
+                       MathHelper::Lerp(f.W, to.W, t));
+    }
+
+    YAX_INLINE Vector4 Vector4::Max(const Vector4& v1, const Vector4& v2)
+    {
+        return Vector4(MathHelper::Max(v1.X, v2.X),
+                       MathHelper::Max(v1.Y, v2.Y),
+                       MathHelper::Max(v1.Z, v2.Z),
+                       MathHelper::Max(v1.W, v2.W));
+    }
+
+    YAX_INLINE Vector4 Vector4::Min(const Vector4& v1, const Vector4& v2)
+    {
+        return Vector4(MathHelper::Min(v1.X, v2.X),
+                       MathHelper::Min(v1.Y, v2.Y),
+                       MathHelper::Min(v1.Z, v2.Z),
+                       MathHelper::Min(v1.W, v2.W));
+    }
+
+    YAX_INLINE Vector4 Vector4::Normalize(Vector4 v)
+    {
+        v.Normalize();
+        return v;
+    }
+
+    YAX_INLINE Vector4 Vector4::SmoothStep(const Vector4& f, const Vector4& to, float t)
+    {
+        return Vector4(MathHelper::SmoothStep(f.X, to.X, t),
+                       MathHelper::SmoothStep(f.Y, to.Y, t),
+                       MathHelper::SmoothStep(f.Z, to.Z, t),
+                       MathHelper::SmoothStep(f.W, to.W, t));
+    }
+
+    YAX_INLINE Vector4 Vector4::Transform(const Vector4& v, const Matrix& m)
+    {
+        float x = v.X*m.M11 + v.Y*m.M21 + v.Z*m.M31 + v.W*m.M41;
+        float y = v.X*m.M12 + v.Y*m.M22 + v.Z*m.M32 + v.W*m.M42;
+        float z = v.X*m.M13 + v.Y*m.M23 + v.Z*m.M33 + v.W*m.M43;
+        float w = v.X*m.M14 + v.Y*m.M24 + v.Z*m.M34 + v.W*m.M44;
+
+        return Vector4(x, y, z, w);
+    }
+
+    YAX_INLINE Vector4 Vector4::Transform(const Vector4& v, const Quaternion& q)
+    {
+        Quaternion vQ(v.X, v.Y, v.Z, v.W);
+        Quaternion res = q*vQ*Quaternion::Inverse(q);
+        
+        return Vector4(res.X, res.Y, res.Z, res.W);
+    }
+
+    YAX_INLINE void Vector4::Transform(const std::vector<Vector4>& source, ui32 sourceIdx, const Matrix& mat, std::vector<Vector4>& dest, ui32 destIdx, ui32 count)
+    {
+        Transform(source.data() + sourceIdx, sizeof(Vector4), mat, dest.data() + destIdx, sizeof(Vector4), count);
+    }
+
+    YAX_INLINE void Vector4::Transform(const std::vector<Vector4>& source, ui32 sourceIdx, const Quaternion& q, std::vector<Vector4>& dest, ui32 destIdx, ui32 count)
+    {
+        Transform(source.data() + sourceIdx, sizeof(Vector4), q, dest.data() + destIdx, sizeof(Vector4), count);
+    }
+
+    YAX_INLINE void Vector4::Transform(const std::vector<Vector4>& source, const Matrix& mat, std::vector<Vector4>& dest)
+    {
+        Transform(source, 0, mat, dest, 0, (ui32)source.size());
+    }
+
+    YAX_INLINE void Vector4::Transform(const std::vector<Vector4>& source, const Quaternion& q, std::vector<Vector4>& dest)
+    {
+        Transform(source, 0, q, dest, 0, (ui32)source.size());
+    }
+
+    YAX_INLINE Vector4 Vector4::TransformNormal(const Vector4& norm, const Matrix& mat)
+    {
+        float x = norm.X*mat.M11 + norm.Y*mat.M21 + norm.Z*mat.M31;
+        float y = norm.X*mat.M12 + norm.Y*mat.M22 + norm.Z*mat.M32;
+        float z = norm.X*mat.M13 + norm.Y*mat.M23 + norm.Z*mat.M33;
+                                                             
+        return Vector4(x, y, z, 0);
+    }
+
+    YAX_INLINE void Vector4::TransformNormal(const std::vector<Vector4>& source, ui32 sourceIdx, const Matrix& mat, std::vector<Vector4>& dest, ui32 destIdx, ui32 count)
+    {
+        TransformNormal(source.data() + sourceIdx, sizeof(Vector4), mat, dest.data() + destIdx, sizeof(Vector4), count);
+    }
+
+    YAX_INLINE void Vector4::TransformNormal(const std::vector<Vector4>& source, const Matrix& mat, std::vector<Vector4>& dest)
+    {
+        TransformNormal(source, 0, mat, dest, 0, (ui32)source.size());
+    }
+
+    YAX_INLINE void Vector4::Transform(const Vector4* source, ui32 sourceStride, const Matrix& mat, Vector4* dest, ui32 destStride, ui32 count)
+    {
+        //Copied so the compiler can keep it in registers even though dest may alias it
+        Matrix m = mat;
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            StridedElement(dest, destStride, i) = Transform(StridedElement(source, sourceStride, i), m);
+        }
+    }
+
+    YAX_INLINE void Vector4::Transform(const Vector4* source, ui32 sourceStride, const Quaternion& q, Vector4* dest, ui32 destStride, ui32 count)
+    {
+        Quaternion rot = q;
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            StridedElement(dest, destStride, i) = Transform(StridedElement(source, sourceStride, i), rot);
+        }
+    }
+
+    YAX_INLINE void Vector4::TransformNormal(const Vector4* source, ui32 sourceStride, const Matrix& mat, Vector4* dest, ui32 destStride, ui32 count)
+    {
+        Matrix m = mat;
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            StridedElement(dest, destStride, i) = TransformNormal(StridedElement(source, sourceStride, i), m);
+        }
+    }
+
+    YAX_INLINE void Vector4::Transform(ExecutionPolicy policy, const Vector4* source, ui32 sourceStride, const Matrix& mat, Vector4* dest, ui32 destStride, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(sourceStride + destStride), [&](ui32 begin, ui32 end)
+        {
+            Transform(&StridedElement(source, sourceStride, begin), sourceStride, mat, &StridedElement(dest, destStride, begin), destStride, end - begin);
+        });
+    }
+
+    YAX_INLINE void Vector4::Transform(ExecutionPolicy policy, const Vector4* source, ui32 sourceStride, const Quaternion& q, Vector4* dest, ui32 destStride, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(sourceStride + destStride), [&](ui32 begin, ui32 end)
+        {
+            Transform(&StridedElement(source, sourceStride, begin), sourceStride, q, &StridedElement(dest, destStride, begin), destStride, end - begin);
+        });
+    }
+
+    YAX_INLINE void Vector4::TransformNormal(ExecutionPolicy policy, const Vector4* source, ui32 sourceStride, const Matrix& mat, Vector4* dest, ui32 destStride, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(sourceStride + destStride), [&](ui32 begin, ui32 end)
+        {
+            TransformNormal(&StridedElement(source, sourceStride, begin), sourceStride, mat, &StridedElement(dest, destStride, begin), destStride, end - begin);
+        });
+    }
+
+    YAX_INLINE void Vector4::Project(const Vector4* source, const Matrix& m,
+                                     float x, float y, float width, float height, float minDepth, float maxDepth,
+                                     Vector3* dest, ui8* outcodes, ui32 count)
+    {
+        float halfWidth = 0.5f * width;
+        float halfHeight = 0.5f * height;
+        float depthRange = maxDepth - minDepth;
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        __m128 mat[16];
+        for (ui32 j = 0; j < 16; j++)
+        {
+            mat[j] = _mm_set1_ps((&m.M11)[j]);
+        }
+
+        __m128 one = _mm_set1_ps(1.0f);
+        __m128 vx = _mm_set1_ps(x), vy = _mm_set1_ps(y);
+        __m128 vHalfWidth = _mm_set1_ps(halfWidth), vHalfHeight = _mm_set1_ps(halfHeight);
+        __m128 vMinDepth = _mm_set1_ps(minDepth), vDepthRange = _mm_set1_ps(depthRange);
+        __m128 zero = _mm_setzero_ps();
+
+        //Four points at a time, transposed so each register holds one component of all four
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 px = _mm_loadu_ps(&source[i].X);
+            __m128 py = _mm_loadu_ps(&source[i + 1].X);
+            __m128 pz = _mm_loadu_ps(&source[i + 2].X);
+            __m128 pw = _mm_loadu_ps(&source[i + 3].X);
+            _MM_TRANSPOSE4_PS(px, py, pz, pw);
+
+            __m128 clip[4];
+            for (ui32 c = 0; c < 4; c++)
+            {
+                __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, mat[c]), _mm_mul_ps(py, mat[4 + c])), _mm_mul_ps(pz, mat[8 + c]));
+                clip[c] = _mm_add_ps(sum, _mm_mul_ps(pw, mat[12 + c]));
+            }
+
+            if (outcodes != nullptr)
+            {
+                __m128 negW = _mm_sub_ps(zero, clip[3]);
+                __m128i code = _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(clip[0], negW)), _mm_set1_epi32(Outcode::Left));
+                code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(clip[0], clip[3])), _mm_set1_epi32(Outcode::Right)));
+                code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(clip[1], negW)), _mm_set1_epi32(Outcode::Bottom)));
+                code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(clip[1], clip[3])), _mm_set1_epi32(Outcode::Top)));
+                code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(clip[2], zero)), _mm_set1_epi32(Outcode::Near)));
+                code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(clip[2], clip[3])), _mm_set1_epi32(Outcode::Far)));
+
+                //Narrow the four 32-bit codes to bytes
+                code = _mm_packus_epi16(_mm_packs_epi32(code, code), code);
+                i32 packed = _mm_cvtsi128_si32(code);
+                for (ui32 k = 0; k < 4; k++)
+                {
+                    outcodes[i + k] = static_cast<ui8>(packed >> (8 * k));
+                }
+            }
+
+            __m128 invW = _mm_div_ps(one, clip[3]);
+            __m128 sx = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(clip[0], invW), one), vHalfWidth), vx);
+            __m128 sy = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(clip[1], invW)), vHalfHeight), vy);
+            __m128 sz = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(clip[2], invW), vDepthRange), vMinDepth);
+
+            __m128 a, b, c;
+            SIMD::Interleave3(sx, sy, sz, a, b, c);
+            _mm_storeu_ps(&dest[i].X, a);
+            _mm_storeu_ps(&dest[i].X + 4, b);
+            _mm_storeu_ps(&dest[i].X + 8, c);
+        }
+#endif
+        for (; i < count; i++)
+        {
+            Vector4 clip = Transform(source[i], m);
+
+            if (outcodes != nullptr)
+            {
+                ui8 code = 0;
+                code |= clip.X < -clip.W ? Outcode::Left : 0;
+                code |= clip.X > clip.W ? Outcode::Right : 0;
+                code |= clip.Y < -clip.W ? Outcode::Bottom : 0;
+                code |= clip.Y > clip.W ? Outcode::Top : 0;
+                code |= clip.Z < 0 ? Outcode::Near : 0;
+                code |= clip.Z > clip.W ? Outcode::Far : 0;
+                outcodes[i] = code;
+            }
+
+            float invW = 1.0f / clip.W;
+            dest[i] = Vector3((clip.X*invW + 1)*halfWidth + x,
+                              (1 - clip.Y*invW)*halfHeight + y,
+                              clip.Z*invW*depthRange + minDepth);
+        }
+    }
+
+    YAX_INLINE Vector4& Vector4::operator+=(const Vector4& v)
+    {
+        X += v.X; 
+        Y += v.Y;
+        Z += v.Z;
+        W += v.W;
+        return *this;
+    }
+
+    YAX_INLINE Vector4& Vector4::operator-=(const Vector4& v)
+    {
+        X /= v.X;
+        Y /= v.Y;
+        Z /= v.Z;
+        W /= v.W;
+        return *this;
+    }
+
+    YAX_INLINE Vector4& Vector4::operator*=(const Vector4& v)
+    {
+        X *= v.X;
+        Y *= v.Y;
+        Z *= v.Z;
+        W *= v.W;
+        return *this;
+    }
+
+    YAX_INLINE Vector4& Vector4::operator*=(float f)
+    {
+        X *= f;
+        Y *= f;
+        Z *= f;
+        W *= f;
+        return *this;
+    }
+
+    YAX_INLINE Vector4& Vector4::operator/=(const Vector4& v)
+    {
+        X /= v.X;
+        Y /= v.Y;
+        Z /= v.Z;
+        W /= v.W;
+        return *this;
+    }
+
+    YAX_INLINE Vector4& Vector4::operator/=(float f)
+    {
+        X /= f;
+        Y /= f;
+        Z /= f;
+        W /= f;
+        return *this;
+    }
+
+    YAX_INLINE Vector4 operator+(Vector4 lhs, const Vector4& rhs)
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Vector4 operator-(Vector4 lhs, const Vector4& rhs)
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Vector4 operator*(Vector4 lhs, const Vector4& rhs)
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Vector4 operator*(float lhs, Vector4 rhs)
+    {
+        rhs *= lhs;
+        return rhs;
+    }
+
+    YAX_INLINE Vector4 operator*(Vector4 lhs, float rhs)
+    {
+        return rhs*lhs;
+    }
+
+    YAX_INLINE Vector4 operator/(Vector4 lhs, const Vector4& rhs)
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Vector4 operator/(Vector4 lhs, float rhs)
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    YAX_INLINE Vector4 operator-(Vector4 rhs)
+    {
+        rhs.X = -rhs.X;
+        rhs.Y = -rhs.Y;
+        rhs.Z = -rhs.Z;
+        rhs.W = -rhs.W;
+        return rhs;
+    }
+
+    YAX_INLINE bool operator==(const Vector4& lhs, const Vector4& rhs)
+    {
+        using MathHelper::EqualWithinEpsilon;
+
+        return EqualWithinEpsilon(lhs.X, rhs.X) &&
+               EqualWithinEpsilon(lhs.Y, rhs.Y) &&
+               EqualWithinEpsilon(lhs.Z, rhs.Z) &&
+               EqualWithinEpsilon(lhs.W, rhs.W);
+    }
+
+    YAX_INLINE bool operator!=(const Vector4& lhs, const Vector4& rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef _VEC4A_H
+#define _VEC4A_H
+
+#include "Parallel.h"
+#include "Utils.h"
+
+namespace YAX
+{
+    struct Vector4;
+    struct MatrixA;
+
+    /**
+    * @brief A 16-byte aligned Vector4, for storage that is fed to SIMD code
+    */
+    struct alignas(16) Vector4A
+    {
+        float X, Y, Z, W;
+
+        Vector4A() = default;
+        constexpr Vector4A(float x, float y, float z, float w);
+        constexpr Vector4A(const Vector4& v);
+
+        constexpr operator Vector4() const;
+
+        /**
+        * @brief Calculates the dot product between two Vector4As
+        */
+        static float Dot(const Vector4A& v1, const Vector4A& v2);
+
+        /**
+        * @brief Transforms a Vector4A by a matrix
+        *
+        * @param v The vector to transform
+        * @param mat The transformation matrix
+        * @return The transformed Vector4A
+        */
+        static Vector4A Transform(const Vector4A& v, const MatrixA& mat);
+
+        /**
+        * @brief Transforms an array of Vector4As by a matrix
+        *
+        * @param source The array of Vector4As to transform
+        * @param mat The transformation matrix
+        * @param dest The array to store the transformed Vector4As in; may be the same array as source
+        * @param count The number of Vector4As to transform
+        */
+        static void Transform(const Vector4A* source, const MatrixA& mat, Vector4A* dest, ui32 count);
+
+        /**
+        * @brief Transforms an array of Vector4As by a matrix, spreading the work across threads
+        *
+        * @param policy How to run the work; see Parallel::For
+        * @param source The array of Vector4As to transform
+        * @param mat The transformation matrix
+        * @param dest The array to store the transformed Vector4As in; may be the same array as source
+        * @param count The number of Vector4As to transform
+        */
+        static void Transform(ExecutionPolicy policy, const Vector4A* source, const MatrixA& mat, Vector4A* dest, ui32 count);
+    };
+
+    Vector4A operator+(const Vector4A&, const Vector4A&);
+    Vector4A operator-(const Vector4A&, const Vector4A&);
+    Vector4A operator*(const Vector4A&, const Vector4A&);
+    Vector4A operator*(const Vector4A&, float);
+    Vector4A operator*(float, const Vector4A&);
+}
+
+//Included after the declarations above so that the headers can depend on each other
+#include "Vector4.h"
+
+namespace YAX
+{
+    constexpr Vector4A::Vector4A(float x, float y, float z, float w)
+        : X(x), Y(y), Z(z), W(w)
+    {}
+
+    constexpr Vector4A::Vector4A(const Vector4& v)
+        : X(v.X), Y(v.Y), Z(v.Z), W(v.W)
+    {}
+
+    constexpr Vector4A::operator Vector4() const
+    {
+        return Vector4(X, Y, Z, W);
+    }
+}
+
+#ifdef YAX_MATH_INLINE
+#include "Vector4A.inl"
+#endif
+
+#endif
@@ -0,0 +1,110 @@
+#include "MatrixA.h"
+#include "SIMD.h"
+
+namespace YAX
+{
+    static_assert(sizeof(Vector4A) == 4 * sizeof(float), "Vector4A must be 4 tightly packed floats");
+
+#ifdef YAX_SSE
+    namespace Detail
+    {
+        YAX_INLINE Vector4A StoreVector4A(__m128 v)
+        {
+            Vector4A res;
+            _mm_store_ps(&res.X, v);
+            return res;
+        }
+    }
+#endif
+
+    YAX_INLINE float Vector4A::Dot(const Vector4A& v1, const Vector4A& v2)
+    {
+#ifdef YAX_SSE
+        return _mm_cvtss_f32(SIMD::Dot4(_mm_load_ps(&v1.X), _mm_load_ps(&v2.X)));
+#else
+        return v1.X*v2.X + v1.Y*v2.Y + v1.Z*v2.Z + v1.W*v2.W;
+#endif
+    }
+
+    YAX_INLINE Vector4A Vector4A::Transform(const Vector4A& v, const MatrixA& mat)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector4A(SIMD::MultiplyRow(_mm_load_ps(&v.X), _mm_load_ps(&mat.M11), _mm_load_ps(&mat.M21),
+                                                       _mm_load_ps(&mat.M31), _mm_load_ps(&mat.M41)));
+#else
+        return Vector4A(v.X*mat.M11 + v.Y*mat.M21 + v.Z*mat.M31 + v.W*mat.M41,
+                        v.X*mat.M12 + v.Y*mat.M22 + v.Z*mat.M32 + v.W*mat.M42,
+                        v.X*mat.M13 + v.Y*mat.M23 + v.Z*mat.M33 + v.W*mat.M43,
+                        v.X*mat.M14 + v.Y*mat.M24 + v.Z*mat.M34 + v.W*mat.M44);
+#endif
+    }
+
+    YAX_INLINE void Vector4A::Transform(const Vector4A* source, const MatrixA& mat, Vector4A* dest, ui32 count)
+    {
+#ifdef YAX_SSE
+        __m128 b0 = _mm_load_ps(&mat.M11);
+        __m128 b1 = _mm_load_ps(&mat.M21);
+        __m128 b2 = _mm_load_ps(&mat.M31);
+        __m128 b3 = _mm_load_ps(&mat.M41);
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            _mm_store_ps(&dest[i].X, SIMD::MultiplyRow(_mm_load_ps(&source[i].X), b0, b1, b2, b3));
+        }
+#else
+        for (ui32 i = 0; i < count; i++)
+        {
+            dest[i] = Transform(source[i], mat);
+        }
+#endif
+    }
+
+    YAX_INLINE void Vector4A::Transform(ExecutionPolicy policy, const Vector4A* source, const MatrixA& mat, Vector4A* dest, ui32 count)
+    {
+        Parallel::For(policy, count, Parallel::BlockSize(2 * sizeof(Vector4A)), [&](ui32 begin, ui32 end)
+        {
+            Transform(source + begin, mat, dest + begin, end - begin);
+        });
+    }
+
+    YAX_INLINE Vector4A operator+(const Vector4A& lhs, const Vector4A& rhs)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector4A(_mm_add_ps(_mm_load_ps(&lhs.X), _mm_load_ps(&rhs.X)));
+#else
+        return Vector4A(lhs.X + rhs.X, lhs.Y + rhs.Y, lhs.Z + rhs.Z, lhs.W + rhs.W);
+#endif
+    }
+
+    YAX_INLINE Vector4A operator-(const Vector4A& lhs, const Vector4A& rhs)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector4A(_mm_sub_ps(_mm_load_ps(&lhs.X), _mm_load_ps(&rhs.X)));
+#else
+        return Vector4A(lhs.X - rhs.X, lhs.Y - rhs.Y, lhs.Z - rhs.Z, lhs.W - rhs.W);
+#endif
+    }
+
+    YAX_INLINE Vector4A operator*(const Vector4A& lhs, const Vector4A& rhs)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector4A(_mm_mul_ps(_mm_load_ps(&lhs.X), _mm_load_ps(&rhs.X)));
+#else
+        return Vector4A(lhs.X * rhs.X, lhs.Y * rhs.Y, lhs.Z * rhs.Z, lhs.W * rhs.W);
+#endif
+    }
+
+    YAX_INLINE Vector4A operator*(const Vector4A& lhs, float rhs)
+    {
+#ifdef YAX_SSE
+        return Detail::StoreVector4A(_mm_mul_ps(_mm_load_ps(&lhs.X), _mm_set1_ps(rhs)));
+#else
+        return Vector4A(lhs.X * rhs, lhs.Y * rhs, lhs.Z * rhs, lhs.W * rhs);
+#endif
+    }
+
+    YAX_INLINE Vector4A operator*(float lhs, const Vector4A& rhs)
+    {
+        return rhs * lhs;
+    }
+}
@@ -0,0 +1,310 @@
+#include <cmath>
+#include "Matrix.h"
+#include "SIMD.h"
+#include "Vector4.h"
+
+namespace YAX
+{
+    namespace Detail
+    {
+        //Transforms the component arrays of a Vector4SoA, summing the products in the same order as Vector4::Transform
+        YAX_INLINE void TransformLanes(const float* sx, const float* sy, const float* sz, const float* sw, const Matrix& mat,
+                                       float* x, float* y, float* z, float* w, ui32 count)
+        {
+#ifdef YAX_SSE
+            //Each column of the matrix is broadcast so every lane handles a different Vector4;
+            //the products are summed in the same order as Vector4::Transform
+            __m128 m[16];
+            for (ui32 j = 0; j < 16; j++)
+            {
+                m[j] = _mm_set1_ps((&mat.M11)[j]);
+            }
+
+            for (ui32 i = 0; i < count; i += 4)
+            {
+                __m128 vx = _mm_load_ps(sx + i), vy = _mm_load_ps(sy + i), vz = _mm_load_ps(sz + i), vw = _mm_load_ps(sw + i);
+                __m128 r[4];
+
+                for (ui32 c = 0; c < 4; c++)
+                {
+                    __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m[c]), _mm_mul_ps(vy, m[4 + c])), _mm_mul_ps(vz, m[8 + c]));
+                    r[c] = _mm_add_ps(sum, _mm_mul_ps(vw, m[12 + c]));
+                }
+
+                _mm_store_ps(x + i, r[0]);
+                _mm_store_ps(y + i, r[1]);
+                _mm_store_ps(z + i, r[2]);
+                _mm_store_ps(w + i, r[3]);
+            }
+#else
+            Matrix m = mat;
+
+            for (ui32 i = 0; i < count; i++)
+            {
+                Vector4 r = Vector4::Transform(Vector4(sx[i], sy[i], sz[i], sw[i]), m);
+                x[i] = r.X;
+                y[i] = r.Y;
+                z[i] = r.Z;
+                w[i] = r.W;
+            }
+#endif
+        }
+    }
+
+    YAX_INLINE Vector4SoA::Vector4SoA()
+    {}
+
+    YAX_INLINE Vector4SoA::Vector4SoA(ui32 count)
+    {
+        Resize(count);
+    }
+
+    YAX_INLINE Vector4SoA::Vector4SoA(const Vector4* source, ui32 count)
+    {
+        CopyFrom(source, count);
+    }
+
+    YAX_INLINE ui32 Vector4SoA::Size() const
+    {
+        return storage.Size();
+    }
+
+    YAX_INLINE ui32 Vector4SoA::PaddedSize() const
+    {
+        return storage.PaddedSize();
+    }
+
+    YAX_INLINE void Vector4SoA::Resize(ui32 count)
+    {
+        storage.Resize(count);
+    }
+
+    YAX_INLINE float* Vector4SoA::X()
+    {
+        return storage.Component(0);
+    }
+
+    YAX_INLINE float* Vector4SoA::Y()
+    {
+        return storage.Component(1);
+    }
+
+    YAX_INLINE float* Vector4SoA::Z()
+    {
+        return storage.Component(2);
+    }
+
+    YAX_INLINE float* Vector4SoA::W()
+    {
+        return storage.Component(3);
+    }
+
+    YAX_INLINE const float* Vector4SoA::X() const
+    {
+        return storage.Component(0);
+    }
+
+    YAX_INLINE const float* Vector4SoA::Y() const
+    {
+        return storage.Component(1);
+    }
+
+    YAX_INLINE const float* Vector4SoA::Z() const
+    {
+        return storage.Component(2);
+    }
+
+    YAX_INLINE const float* Vector4SoA::W() const
+    {
+        return storage.Component(3);
+    }
+
+    YAX_INLINE Vector4 Vector4SoA::Get(ui32 index) const
+    {
+        return Vector4(X()[index], Y()[index], Z()[index], W()[index]);
+    }
+
+    YAX_INLINE void Vector4SoA::Set(ui32 index, const Vector4& v)
+    {
+        X()[index] = v.X;
+        Y()[index] = v.Y;
+        Z()[index] = v.Z;
+        W()[index] = v.W;
+    }
+
+    YAX_INLINE void Vector4SoA::CopyFrom(const Vector4* source, ui32 count)
+    {
+        Resize(count);
+
+        float *x = X(), *y = Y(), *z = Z(), *w = W();
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        const float* src = &source->X;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 r0 = _mm_loadu_ps(src + 4 * i);
+            __m128 r1 = _mm_loadu_ps(src + 4 * i + 4);
+            __m128 r2 = _mm_loadu_ps(src + 4 * i + 8);
+            __m128 r3 = _mm_loadu_ps(src + 4 * i + 12);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_store_ps(x + i, r0);
+            _mm_store_ps(y + i, r1);
+            _mm_store_ps(z + i, r2);
+            _mm_store_ps(w + i, r3);
+        }
+#endif
+        for (; i < count; i++)
+        {
+            x[i] = source[i].X;
+            y[i] = source[i].Y;
+            z[i] = source[i].Z;
+            w[i] = source[i].W;
+        }
+    }
+
+    YAX_INLINE void Vector4SoA::CopyTo(Vector4* dest) const
+    {
+        const float *x = X(), *y = Y(), *z = Z(), *w = W();
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        float* dst = &dest->X;
+
+        for (; i + 4 <= Size(); i += 4)
+        {
+            __m128 r0 = _mm_load_ps(x + i);
+            __m128 r1 = _mm_load_ps(y + i);
+            __m128 r2 = _mm_load_ps(z + i);
+            __m128 r3 = _mm_load_ps(w + i);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(dst + 4 * i, r0);
+            _mm_storeu_ps(dst + 4 * i + 4, r1);
+            _mm_storeu_ps(dst + 4 * i + 8, r2);
+            _mm_storeu_ps(dst + 4 * i + 12, r3);
+        }
+#endif
+        for (; i < Size(); i++)
+        {
+            dest[i] = Vector4(x[i], y[i], z[i], w[i]);
+        }
+    }
+
+    YAX_INLINE void Vector4SoA::DistanceSquared(const Vector4SoA& p1, const Vector4SoA& p2, float* dest)
+    {
+        const float *x1 = p1.X(), *y1 = p1.Y(), *z1 = p1.Z(), *w1 = p1.W();
+        const float *x2 = p2.X(), *y2 = p2.Y(), *z2 = p2.Z(), *w2 = p2.W();
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        for (; i + 4 <= p1.Size(); i += 4)
+        {
+            __m128 dx = _mm_sub_ps(_mm_load_ps(x1 + i), _mm_load_ps(x2 + i));
+            __m128 dy = _mm_sub_ps(_mm_load_ps(y1 + i), _mm_load_ps(y2 + i));
+            __m128 dz = _mm_sub_ps(_mm_load_ps(z1 + i), _mm_load_ps(z2 + i));
+            __m128 dw = _mm_sub_ps(_mm_load_ps(w1 + i), _mm_load_ps(w2 + i));
+            __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+            _mm_storeu_ps(dest + i, _mm_add_ps(sum, _mm_mul_ps(dw, dw)));
+        }
+#endif
+        for (; i < p1.Size(); i++)
+        {
+            float dx = x1[i] - x2[i];
+            float dy = y1[i] - y2[i];
+            float dz = z1[i] - z2[i];
+            float dw = w1[i] - w2[i];
+            dest[i] = dx*dx + dy*dy + dz*dz + dw*dw;
+        }
+    }
+
+    YAX_INLINE void Vector4SoA::Dot(const Vector4SoA& v1, const Vector4SoA& v2, float* dest)
+    {
+        const float *x1 = v1.X(), *y1 = v1.Y(), *z1 = v1.Z(), *w1 = v1.W();
+        const float *x2 = v2.X(), *y2 = v2.Y(), *z2 = v2.Z(), *w2 = v2.W();
+        ui32 i = 0;
+
+#ifdef YAX_SSE
+        for (; i + 4 <= v1.Size(); i += 4)
+        {
+            __m128 xx = _mm_mul_ps(_mm_load_ps(x1 + i), _mm_load_ps(x2 + i));
+            __m128 yy = _mm_mul_ps(_mm_load_ps(y1 + i), _mm_load_ps(y2 + i));
+            __m128 zz = _mm_mul_ps(_mm_load_ps(z1 + i), _mm_load_ps(z2 + i));
+            __m128 ww = _mm_mul_ps(_mm_load_ps(w1 + i), _mm_load_ps(w2 + i));
+            _mm_storeu_ps(dest + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(xx, yy), zz), ww));
+        }
+#endif
+        for (; i < v1.Size(); i++)
+        {
+            dest[i] = x1[i]*x2[i] + y1[i]*y2[i] + z1[i]*z2[i] + w1[i]*w2[i];
+        }
+    }
+
+    YAX_INLINE void Vector4SoA::Lerp(const Vector4SoA& v1, const Vector4SoA& v2, float t, Vector4SoA& dest)
+    {
+        dest.Resize(v1.Size());
+        Detail::LerpLanes(v1.storage.Lanes(), v2.storage.Lanes(), t, dest.storage.Lanes(), dest.storage.LaneCount());
+    }
+
+    YAX_INLINE void Vector4SoA::Max(const Vector4SoA& v1, const Vector4SoA& v2, Vector4SoA& dest)
+    {
+        dest.Resize(v1.Size());
+        Detail::MaxLanes(v1.storage.Lanes(), v2.storage.Lanes(), dest.storage.Lanes(), dest.storage.LaneCount());
+    }
+
+    YAX_INLINE void Vector4SoA::Min(const Vector4SoA& v1, const Vector4SoA& v2, Vector4SoA& dest)
+    {
+        dest.Resize(v1.Size());
+        Detail::MinLanes(v1.storage.Lanes(), v2.storage.Lanes(), dest.storage.Lanes(), dest.storage.LaneCount());
+    }
+
+    YAX_INLINE void Vector4SoA::Normalize(const Vector4SoA& source, Vector4SoA& dest)
+    {
+        dest.Resize(source.Size());
+
+        const float *sx = source.X(), *sy = source.Y(), *sz = source.Z(), *sw = source.W();
+        float *x = dest.X(), *y = dest.Y(), *z = dest.Z(), *w = dest.W();
+        ui32 n = dest.PaddedSize();
+
+#ifdef YAX_SSE
+        for (ui32 i = 0; i < n; i += 4)
+        {
+            __m128 vx = _mm_load_ps(sx + i), vy = _mm_load_ps(sy + i), vz = _mm_load_ps(sz + i), vw = _mm_load_ps(sw + i);
+            __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+            __m128 len = _mm_sqrt_ps(_mm_add_ps(sum, _mm_mul_ps(vw, vw)));
+            _mm_store_ps(x + i, _mm_div_ps(vx, len));
+            _mm_store_ps(y + i, _mm_div_ps(vy, len));
+            _mm_store_ps(z + i, _mm_div_ps(vz, len));
+            _mm_store_ps(w + i, _mm_div_ps(vw, len));
+        }
+#else
+        for (ui32 i = 0; i < n; i++)
+        {
+            float len = std::sqrt(sx[i]*sx[i] + sy[i]*sy[i] + sz[i]*sz[i] + sw[i]*sw[i]);
+            x[i] = sx[i] / len;
+            y[i] = sy[i] / len;
+            z[i] = sz[i] / len;
+            w[i] = sw[i] / len;
+        }
+#endif
+    }
+
+    YAX_INLINE void Vector4SoA::Transform(const Vector4SoA& source, const Matrix& mat, Vector4SoA& dest)
+    {
+        dest.Resize(source.Size());
+        Detail::TransformLanes(source.X(), source.Y(), source.Z(), source.W(), mat, dest.X(), dest.Y(), dest.Z(), dest.W(), dest.PaddedSize());
+    }
+
+    YAX_INLINE void Vector4SoA::Transform(ExecutionPolicy policy, const Vector4SoA& source, const Matrix& mat, Vector4SoA& dest)
+    {
+        static_assert(Parallel::BlockSize(8 * sizeof(float)) % Width == 0, "Blocks must start on a whole number of SIMD lanes");
+
+        dest.Resize(source.Size());
+
+        Parallel::For(policy, dest.PaddedSize(), Parallel::BlockSize(8 * sizeof(float)), [&](ui32 begin, ui32 end)
+        {
+            Detail::TransformLanes(source.X() + begin, source.Y() + begin, source.Z() + begin, source.W() + begin, mat,
+                                   dest.X() + begin, dest.Y() + begin, dest.Z() + begin, dest.W() + begin, end - begin);
+        });
+    }
+}
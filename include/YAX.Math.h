@@ -1,12 +1,23 @@
 #ifndef _YAX_MATH
 #define _YAX_MATH
 
+#include "AffineTransform.h"
+#include "DualQuaternion.h"
 #include "MathHelper.h"
 #include "Matrix.h"
+#include "Matrix2D.h"
+#include "MatrixA.h"
+#include "MatrixExpression.h"
+#include "PackedQuaternion.h"
+#include "Parallel.h"
 #include "Quaternion.h"
 #include "Vector2.h"
 #include "Vector3.h"
+#include "Vector3A.h"
+#include "Vector3SoA.h"
 #include "Vector4.h"
+#include "Vector4A.h"
+#include "Vector4SoA.h"
 
 #endif
 
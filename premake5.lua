@@ -1,9 +1,15 @@
+newoption {
+    trigger = "avx",
+    description = "Compile for CPUs with AVX, enabling the AVX code paths that aren't picked at runtime"
+}
+
 solution "YAX.Math"
     configurations { "Debug32", "Debug64", "Release32", "Release64" }
     
 project "YAX.Math"
     kind "StaticLib"
     language "C++"
+    cppdialect "C++17"
 
     targetdir "out/%{cfg.buildcfg}/%{cfg.platform}"
     includedirs "include/"
@@ -25,9 +31,59 @@ project "YAX.Math"
     filter "configurations:Release*"
         floatingpoint "Strict"
         optimize "Full"
+
+    filter "options:avx"
+        vectorextensions "AVX"
         
     filter "system:windows"
         postbuildcommands {"xcopy include out\\include\\ /I /E /Y"}
         
     filter "system:not windows"
-        postbuildcommands {"cp -r ./include ./out/"}
\ No newline at end of file
+        buildoptions "-pthread"
+        postbuildcommands {"cp -r ./include ./out/"}
+
+--A console program built from the headers alone (YAX_MATH_INLINE), so it doesn't depend on how the library was built
+local function consoleproject(name, sourceDir, extraDefines)
+    project(name)
+        kind "ConsoleApp"
+        language "C++"
+        cppdialect "C++17"
+
+        targetdir "out/%{cfg.buildcfg}/%{cfg.platform}"
+        includedirs "include/"
+        files(sourceDir .. "/*.h")
+        files(sourceDir .. "/*.cpp")
+        defines "YAX_MATH_INLINE"
+        defines(extraDefines or {})
+        warnings "Extra"
+
+        filter "configurations:*32"
+            architecture "x86"
+
+        filter "configurations:*64"
+            architecture "x86_64"
+
+        filter "configurations:Debug*"
+            optimize "Off"
+
+        filter "configurations:Release*"
+            floatingpoint "Strict"
+            optimize "Full"
+
+        filter "options:avx"
+            vectorextensions "AVX"
+
+        filter "system:not windows"
+            buildoptions "-pthread"
+            linkoptions "-pthread"
+
+        filter {}
+end
+
+--Times operator*= and Matrix::Multiply over a world * view * projection chain, with SIMD and with YAX_NO_SIMD
+consoleproject("YAX.Math.Benchmark", "benchmark")
+consoleproject("YAX.Math.Benchmark.Scalar", "benchmark", "YAX_NO_SIMD")
+
+--Checks that the SIMD paths match the scalar code bit for bit, and the documented error bounds; both builds must pass
+consoleproject("YAX.Math.Tests", "tests")
+consoleproject("YAX.Math.Tests.Scalar", "tests", "YAX_NO_SIMD")
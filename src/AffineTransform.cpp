@@ -0,0 +1,5 @@
+#include "AffineTransform.h"
+
+#ifndef YAX_MATH_INLINE
+#include "AffineTransform.inl"
+#endif
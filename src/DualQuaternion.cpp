@@ -0,0 +1,5 @@
+#include "DualQuaternion.h"
+
+#ifndef YAX_MATH_INLINE
+#include "DualQuaternion.inl"
+#endif
@@ -0,0 +1,5 @@
+#include "Matrix2D.h"
+
+#ifndef YAX_MATH_INLINE
+#include "Matrix2D.inl"
+#endif
@@ -0,0 +1,5 @@
+#include "MatrixA.h"
+
+#ifndef YAX_MATH_INLINE
+#include "MatrixA.inl"
+#endif
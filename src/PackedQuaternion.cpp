@@ -0,0 +1,5 @@
+#include "PackedQuaternion.h"
+
+#ifndef YAX_MATH_INLINE
+#include "PackedQuaternion.inl"
+#endif
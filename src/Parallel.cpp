@@ -0,0 +1,5 @@
+#include "Parallel.h"
+
+#ifndef YAX_MATH_INLINE
+#include "Parallel.inl"
+#endif
@@ -0,0 +1,5 @@
+#include "SoAStorage.h"
+
+#ifndef YAX_MATH_INLINE
+#include "SoAStorage.inl"
+#endif
@@ -0,0 +1,5 @@
+#include "Vector3A.h"
+
+#ifndef YAX_MATH_INLINE
+#include "Vector3A.inl"
+#endif
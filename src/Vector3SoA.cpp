@@ -0,0 +1,5 @@
+#include "Vector3SoA.h"
+
+#ifndef YAX_MATH_INLINE
+#include "Vector3SoA.inl"
+#endif
@@ -0,0 +1,5 @@
+#include "Vector4A.h"
+
+#ifndef YAX_MATH_INLINE
+#include "Vector4A.inl"
+#endif
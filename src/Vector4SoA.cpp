@@ -0,0 +1,5 @@
+#include "Vector4SoA.h"
+
+#ifndef YAX_MATH_INLINE
+#include "Vector4SoA.inl"
+#endif
@@ -0,0 +1,39 @@
+#include <exception>
+#include "Test.h"
+
+int main()
+{
+#if defined(YAX_NO_SIMD)
+    std::printf("YAX.Math tests, scalar (YAX_NO_SIMD)\n");
+#elif defined(YAX_AVX)
+    std::printf("YAX.Math tests, AVX\n");
+#elif defined(YAX_SSE)
+    std::printf("YAX.Math tests, SSE2\n");
+#else
+    std::printf("YAX.Math tests, scalar (no SSE2 target)\n");
+#endif
+
+    int failedCases = 0;
+
+    for (const Test::Case& c : Test::Cases())
+    {
+        int before = Test::Failures();
+
+        try
+        {
+            c.Run();
+        }
+        catch (const std::exception& e)
+        {
+            std::printf("  threw %s\n", e.what());
+            Test::Failures()++;
+        }
+
+        bool passed = Test::Failures() == before;
+        failedCases += passed ? 0 : 1;
+        std::printf("%s %s\n", passed ? "[pass]" : "[FAIL]", c.Name);
+    }
+
+    std::printf("%d of %d tests failed\n", failedCases, static_cast<int>(Test::Cases().size()));
+    return failedCases == 0 ? 0 : 1;
+}
@@ -0,0 +1,293 @@
+//Checks the matrix functions whose SIMD and scalar results may differ, against their mathematical definitions
+
+#include "Test.h"
+
+using namespace YAX;
+
+TEST(InvertRoundTrips)
+{
+    for (ui32 i = 0; i < 100; i++)
+    {
+        Vector3 translation(Test::Random(-10, 10), Test::Random(-10, 10), Test::Random(-10, 10));
+        Matrix rigid = Matrix::CreateFromQuaternion(Test::RandomRotation()) * Matrix::CreateTranslation(translation);
+        Matrix m = Matrix::CreateScale(Test::Random(0.5f, 2), Test::Random(0.5f, 2), Test::Random(0.5f, 2)) * rigid;
+        Matrix inverse = Matrix::Identity, affineInverse = Matrix::Identity;
+
+        CHECK(Matrix::Invert(m, inverse, nullptr));
+        CHECK(Matrix::InvertAffine(m, affineInverse, nullptr));
+        CHECK(Test::MaxDifference(inverse * m, Matrix::Identity) < 1e-5f);
+        CHECK(Test::MaxDifference(affineInverse * m, Matrix::Identity) < 1e-5f);
+        CHECK(Test::MaxDifference(Matrix::InvertRigid(rigid) * rigid, Matrix::Identity) < 1e-5f);
+    }
+}
+
+namespace
+{
+    double Minor3(const Matrix& m, ui32 row, ui32 column)
+    {
+        const float* f = &m.M11;
+        double e[9];
+        ui32 n = 0;
+
+        for (ui32 r = 0; r < 4; r++)
+        {
+            for (ui32 c = 0; c < 4; c++)
+            {
+                if (r != row && c != column)
+                {
+                    e[n++] = f[4*r + c];
+                }
+            }
+        }
+
+        return e[0]*(e[4]*e[8] - e[5]*e[7]) - e[1]*(e[3]*e[8] - e[5]*e[6]) + e[2]*(e[3]*e[7] - e[4]*e[6]);
+    }
+
+    //The cofactor matrix evaluated in double precision, and the largest magnitude among its elements
+    Matrix ReferenceCofactor(const Matrix& m, double* largest)
+    {
+        Matrix c = Matrix::Identity;
+        float* f = &c.M11;
+        *largest = 0;
+
+        for (ui32 r = 0; r < 4; r++)
+        {
+            for (ui32 col = 0; col < 4; col++)
+            {
+                double value = ((r + col) % 2 == 0 ? 1 : -1) * Minor3(m, r, col);
+                f[4*r + col] = static_cast<float>(value);
+                *largest = std::fmax(*largest, std::fabs(value));
+            }
+        }
+
+        return c;
+    }
+}
+
+TEST(InvertMatchesDeterminantAndCofactor)
+{
+    for (ui32 i = 0; i < 200; i++)
+    {
+        Matrix m = Test::RandomMatrix();
+        Matrix inverse = Matrix::Identity, cofactor = Matrix::Identity;
+        float determinant = 0;
+
+        CHECK(Matrix::Invert(m, inverse, &determinant, &cofactor));
+
+        //The cofactor matrix is the transposed adjugate, and the adjugate is the inverse scaled by the determinant
+        double largest = 0;
+        Matrix reference = ReferenceCofactor(m, &largest);
+        float tolerance = static_cast<float>(1e-5 * largest);
+
+        CHECK(std::fabs(determinant - m.Determinant()) <= 1e-5f * std::fabs(determinant) + tolerance);
+        CHECK(Test::MaxDifference(cofactor, reference) <= tolerance);
+        CHECK(Test::MaxDifference(cofactor, Matrix::Transpose(inverse) * determinant) <= tolerance);
+    }
+}
+
+TEST(InvertWritesCofactorOfSingular)
+{
+    Matrix singular(1, 2, 3, 0,
+                    2, 4, 6, 0,
+                    0, 1, 5, 0,
+                    7, 8, 9, 1);
+    Matrix result = Matrix::Identity, cofactor = Matrix::Identity;
+    float determinant = 1;
+
+    CHECK(!Matrix::Invert(singular, result, &determinant, &cofactor));
+    CHECK(Test::BitEqual(result, Matrix::Identity));
+    CHECK(determinant == 0);
+
+    double largest = 0;
+    Matrix reference = ReferenceCofactor(singular, &largest);
+    CHECK(largest > 0);
+    CHECK(Test::MaxDifference(cofactor, reference) <= 1e-5f * static_cast<float>(largest));
+}
+
+TEST(InvertBatchMatchesSingle)
+{
+    const ui32 count = 11, singularIndex = 6;
+    std::vector<Matrix> source;
+    for (ui32 i = 0; i < count; i++)
+    {
+        source.push_back(Test::RandomMatrix());
+    }
+
+    source[singularIndex] = Matrix(1, 2, 3, 4, 2, 4, 6, 8, 0, 1, 5, 7, 7, 8, 9, 1);
+
+    std::vector<Matrix> inverses(count, Matrix::Identity), cofactors(count, Matrix::Identity);
+    std::vector<float> determinants(count, 0);
+
+    CHECK(!Matrix::Invert(source.data(), inverses.data(), determinants.data(), cofactors.data(), count));
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        Matrix inverse = Matrix::Identity, cofactor = Matrix::Identity;
+        float determinant = 0;
+
+        CHECK(Matrix::Invert(source[i], inverse, &determinant, &cofactor) == (i != singularIndex));
+        CHECK(Test::BitEqual(inverses[i], inverse));
+        CHECK(Test::BitEqual(cofactors[i], cofactor));
+        CHECK(determinants[i] == determinant);
+    }
+
+    //In place
+    std::vector<Matrix> inPlace = source;
+    inPlace.erase(inPlace.begin() + singularIndex);
+    std::vector<Matrix> expected(inPlace.size(), Matrix::Identity);
+    CHECK(Matrix::Invert(inPlace.data(), expected.data(), nullptr, nullptr, static_cast<ui32>(inPlace.size())));
+    CHECK(Matrix::Invert(inPlace.data(), inPlace.data(), nullptr, nullptr, static_cast<ui32>(inPlace.size())));
+    CHECK(Test::BitEqual(inPlace.data(), expected.data(), static_cast<ui32>(inPlace.size())));
+}
+
+TEST(LazyChainMatchesEager)
+{
+    for (ui32 i = 0; i < 100; i++)
+    {
+        Matrix world = Matrix::CreateFromQuaternion(Test::RandomRotation()) * Matrix::CreateTranslation(Test::Random(-10, 10), Test::Random(-10, 10), Test::Random(-10, 10));
+        Matrix view = Matrix::CreateLookAt(Vector3(Test::Random(-50, 50), 20, 100), Vector3(0, 0, 0), Vector3(0, 1, 0));
+        Matrix proj = Matrix::CreatePerspectiveFieldOfView(MathHelper::PiOver4, 1.5f, 0.1f, 1000);
+        Vector3 v(Test::Random(-5, 5), Test::Random(-5, 5), Test::Random(-5, 5));
+        Vector4 v4(v, 1);
+
+        //Evaluating an expression is an ordinary left-to-right product
+        Matrix lazyProduct = Lazy(world) * view * proj;
+        CHECK(Test::BitEqual(lazyProduct, world * view * proj));
+
+        //Transforming carries the vector through each matrix, so it only matches to rounding
+        Vector3 eager = Vector3::Transform(v, world * view * proj);
+        Vector3 lazy = Vector3::Transform(v, Lazy(world) * view * proj);
+        CHECK(Vector3::Distance(lazy, eager) <= 1e-5f * (1 + eager.Length()));
+
+        Vector4 eager4 = Vector4::Transform(v4, world * view * proj);
+        Vector4 lazy4 = Vector4::Transform(v4, Lazy(world) * Lazy(view) * Lazy(proj));
+        Vector4 difference(lazy4.X - eager4.X, lazy4.Y - eager4.Y, lazy4.Z - eager4.Z, lazy4.W - eager4.W);
+        CHECK(difference.Length() <= 1e-5f * (1 + eager4.Length()));
+
+        //The same operand more than once
+        Matrix squared = Lazy(world) * Lazy(world);
+        CHECK(Test::BitEqual(squared, world * world));
+
+        eager = Vector3::Transform(v, world * world * world);
+        lazy = Vector3::Transform(v, Lazy(world) * world * Lazy(world));
+        CHECK(Vector3::Distance(lazy, eager) <= 1e-5f * (1 + eager.Length()));
+    }
+}
+
+TEST(TransposeIntoMatchesTranspose)
+{
+    const ui32 count = 9, sentinelBits = 0x7FC01234;
+    float sentinel;
+    std::memcpy(&sentinel, &sentinelBits, sizeof(float));
+
+    std::vector<Matrix> source;
+    for (ui32 i = 0; i < count; i++)
+    {
+        source.push_back(Test::RandomMatrix());
+    }
+
+    //A stride of 20 floats keeps an aligned buffer aligned; 21 floats or a one-float offset take the unaligned path
+    alignas(16) float buffer[1 + 21 * count];
+
+    for (bool truncate : { false, true })
+    {
+        for (ui32 strideFloats : { 20u, 21u })
+        {
+            for (ui32 offset : { 0u, 1u })
+            {
+                for (float& f : buffer)
+                {
+                    f = sentinel;
+                }
+
+                float* dest = buffer + offset;
+                Matrix::TransposeInto(source.data(), dest, strideFloats * sizeof(float), count, truncate);
+
+                ui32 written = truncate ? 12 : 16;
+                for (ui32 i = 0; i < count; i++)
+                {
+                    Matrix expected = Matrix::Transpose(source[i]);
+                    const float* out = dest + i * strideFloats;
+
+                    CHECK(std::memcmp(out, &expected.M11, written * sizeof(float)) == 0);
+
+                    for (ui32 k = written; k < strideFloats; k++)
+                    {
+                        CHECK(Test::BitEqual(out[k], sentinel));
+                    }
+                }
+
+                for (ui32 k = 0; k < offset; k++)
+                {
+                    CHECK(Test::BitEqual(buffer[k], sentinel));
+                }
+            }
+        }
+    }
+}
+
+TEST(InvertAcceptsSmallScales)
+{
+    for (float scale : { 1.0f, 0.004f, 1e-6f })
+    {
+        Matrix m = Matrix::CreateScale(scale) * Matrix::CreateFromYawPitchRoll(0.3f, 1.1f, -0.7f) * Matrix::CreateTranslation(1, 2, 3);
+        Matrix inverse = Matrix::Identity, affineInverse = Matrix::Identity;
+
+        CHECK(Matrix::Invert(m, inverse, nullptr));
+        CHECK(Matrix::InvertAffine(m, affineInverse, nullptr));
+        CHECK(Test::MaxDifference(inverse * m, Matrix::Identity) < 1e-5f);
+        CHECK(Test::MaxDifference(affineInverse * m, Matrix::Identity) < 1e-5f);
+    }
+}
+
+TEST(InvertRejectsSingular)
+{
+    Matrix zero(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    Matrix rankDeficient(1, 2, 3, 0,
+                         2, 4, 6, 0,
+                         0, 1, 5, 0,
+                         7, 8, 9, 1);
+    Matrix result = Matrix::Identity;
+
+    CHECK(!Matrix::Invert(zero, result, nullptr));
+    CHECK(!Matrix::InvertAffine(zero, result, nullptr));
+    CHECK(!Matrix::Invert(rankDeficient, result, nullptr));
+    CHECK(!Matrix::InvertAffine(rankDeficient, result, nullptr));
+    CHECK(Test::BitEqual(result, Matrix::Identity));
+
+    //Singular however small it is scaled
+    CHECK(!Matrix::Invert(rankDeficient * Matrix::CreateScale(0.001f), result, nullptr));
+}
+
+TEST(AffineTransformInvertIsScaleRelative)
+{
+    for (float scale : { 1.0f, 0.004f, 1e-6f })
+    {
+        Matrix m = Matrix::CreateScale(scale) * Matrix::CreateFromYawPitchRoll(0.3f, 1.1f, -0.7f) * Matrix::CreateTranslation(scale, 2 * scale, 3 * scale);
+        AffineTransform t = AffineTransform::CreateFromMatrix(m), inverse = AffineTransform::Identity;
+        Vector3 p(4, 5, 6);
+
+        CHECK(AffineTransform::Invert(t, inverse, nullptr));
+        CHECK(Vector3::Distance(AffineTransform::TransformPoint(AffineTransform::TransformPoint(p, t), inverse), p) < 1e-5f);
+    }
+
+    Matrix rankDeficient(1, 2, 3, 0, 2, 4, 6, 0, 0, 1, 5, 0, 7, 8, 9, 1);
+    AffineTransform singular = AffineTransform::CreateFromMatrix(rankDeficient), result = AffineTransform::Identity;
+    CHECK(!AffineTransform::Invert(singular, result, nullptr));
+}
+
+TEST(Matrix2DInvertIsScaleRelative)
+{
+    for (float scale : { 1.0f, 0.004f, 1e-6f })
+    {
+        Matrix2D t = Matrix2D::CreateScale(scale, scale) * Matrix2D::CreateRotation(0.4f) * Matrix2D::CreateTranslation(scale, 2 * scale);
+        Matrix2D inverse = Matrix2D::Identity;
+        Vector2 p(4, 5);
+
+        CHECK(Matrix2D::Invert(t, inverse, nullptr));
+        CHECK(Vector2::Distance(Matrix2D::TransformPoint(Matrix2D::TransformPoint(p, t), inverse), p) < 1e-5f);
+    }
+
+    Matrix2D singular = Matrix2D::CreateScale(1, 0), result = Matrix2D::Identity;
+    CHECK(!Matrix2D::Invert(singular, result, nullptr));
+}
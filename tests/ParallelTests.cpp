@@ -0,0 +1,160 @@
+//Checks that Parallel::For covers every element exactly once, and that the parallel overloads match the sequential ones
+
+#include <atomic>
+#include <stdexcept>
+#include "Test.h"
+
+using namespace YAX;
+
+namespace
+{
+    //Runs a parallel For that records which block wrote each element
+    bool CoversEveryElement(ui32 count, ui32 blockSize)
+    {
+        std::vector<ui32> visits(count, 0);
+        Parallel::For(ExecutionPolicy::Parallel, count, blockSize, [&](ui32 begin, ui32 end)
+        {
+            for (ui32 i = begin; i < end; i++)
+            {
+                visits[i]++;
+            }
+        });
+
+        for (ui32 v : visits)
+        {
+            if (v != 1)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+TEST(ParallelForCoversEveryElement)
+{
+    //With a single thread the body just runs on the caller, so use a pool even on a single-core machine
+    Parallel::SetThreadCount(4);
+
+    CHECK(CoversEveryElement(1, 1));
+    CHECK(CoversEveryElement(100000, 1000));
+    CHECK(CoversEveryElement(100001, 7));
+    CHECK(CoversEveryElement(3, 1000));
+
+    Parallel::SetThreadCount(0);
+}
+
+TEST(ParallelTransformsMatchSequential)
+{
+    Parallel::SetThreadCount(4);
+
+    const ui32 count = 20001;
+    std::vector<Vector3> source, sequential(count), parallel(count);
+    for (ui32 i = 0; i < count; i++)
+    {
+        source.push_back(Vector3(Test::Random(-100, 100), Test::Random(-100, 100), Test::Random(-100, 100)));
+    }
+
+    Matrix m = Test::RandomMatrix();
+
+    Vector3::Transform(source.data(), sizeof(Vector3), m, sequential.data(), sizeof(Vector3), count);
+    Vector3::Transform(ExecutionPolicy::Parallel, source.data(), sizeof(Vector3), m, parallel.data(), sizeof(Vector3), count);
+    CHECK(Test::BitEqual(parallel.data(), sequential.data(), count));
+
+    Vector3::TransformNormal(source.data(), sizeof(Vector3), m, sequential.data(), sizeof(Vector3), count);
+    Vector3::TransformNormal(ExecutionPolicy::Parallel, source.data(), sizeof(Vector3), m, parallel.data(), sizeof(Vector3), count);
+    CHECK(Test::BitEqual(parallel.data(), sequential.data(), count));
+
+    std::vector<Vector4> source4, sequential4(count), parallel4(count);
+    for (const Vector3& v : source)
+    {
+        source4.push_back(Vector4(v, 1));
+    }
+
+    Vector4::Transform(source4.data(), sizeof(Vector4), m, sequential4.data(), sizeof(Vector4), count);
+    Vector4::Transform(ExecutionPolicy::Parallel, source4.data(), sizeof(Vector4), m, parallel4.data(), sizeof(Vector4), count);
+    CHECK(Test::BitEqual(parallel4.data(), sequential4.data(), count));
+
+    //The SoA containers are split on whole SIMD registers; the last block ends in the padding
+    Vector3SoA soa(source.data(), count), soaSequential, soaParallel;
+    Vector3SoA::Transform(soa, m, soaSequential);
+    Vector3SoA::Transform(ExecutionPolicy::Parallel, soa, m, soaParallel);
+    soaSequential.CopyTo(sequential.data());
+    soaParallel.CopyTo(parallel.data());
+    CHECK(Test::BitEqual(parallel.data(), sequential.data(), count));
+
+    //In place this time
+    soaParallel = soa;
+    Vector3SoA::TransformNormal(soa, m, soaSequential);
+    Vector3SoA::TransformNormal(ExecutionPolicy::Parallel, soaParallel, m, soaParallel);
+    soaSequential.CopyTo(sequential.data());
+    soaParallel.CopyTo(parallel.data());
+    CHECK(Test::BitEqual(parallel.data(), sequential.data(), count));
+
+    Vector4SoA soa4(source4.data(), count), soa4Sequential, soa4Parallel;
+    Vector4SoA::Transform(soa4, m, soa4Sequential);
+    Vector4SoA::Transform(ExecutionPolicy::Parallel, soa4, m, soa4Parallel);
+    soa4Sequential.CopyTo(sequential4.data());
+    soa4Parallel.CopyTo(parallel4.data());
+    CHECK(Test::BitEqual(parallel4.data(), sequential4.data(), count));
+
+    Parallel::SetThreadCount(0);
+}
+
+TEST(ParallelForRethrows)
+{
+    Parallel::SetThreadCount(4);
+
+    for (ui32 attempt = 0; attempt < 20; attempt++)
+    {
+        bool caught = false;
+
+        try
+        {
+            Parallel::For(ExecutionPolicy::Parallel, 100000, 100, [](ui32 begin, ui32)
+            {
+                if (begin == 5000)
+                {
+                    throw std::runtime_error("body failed");
+                }
+            });
+        }
+        catch (const std::runtime_error&)
+        {
+            caught = true;
+        }
+
+        //The pool is still usable afterwards
+        CHECK(caught);
+        CHECK(CoversEveryElement(100000, 1000));
+    }
+
+    Parallel::SetThreadCount(0);
+}
+
+TEST(SetThreadCountInsideBodyThrows)
+{
+    Parallel::SetThreadCount(4);
+    std::atomic<ui32> rejected(0), threadCounts(0);
+
+    Parallel::For(ExecutionPolicy::Parallel, 64, 1, [&](ui32, ui32)
+    {
+        threadCounts += Parallel::GetThreadCount() == 4 ? 1 : 0;
+
+        try
+        {
+            Parallel::SetThreadCount(2);
+        }
+        catch (const std::logic_error&)
+        {
+            rejected++;
+        }
+    });
+
+    CHECK(rejected == 64);
+    CHECK(threadCounts == 64);
+    CHECK(CoversEveryElement(100000, 1000));
+
+    Parallel::SetThreadCount(0);
+}
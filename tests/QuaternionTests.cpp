@@ -0,0 +1,168 @@
+//Checks the documented error bounds of the approximate and compressed quaternion functions, and the round trips
+//between quaternions and matrices
+
+#include "Test.h"
+
+using namespace YAX;
+
+namespace
+{
+    //Slerp evaluated in double precision from the angle between the quaternions
+    Quaternion ReferenceSlerp(const Quaternion& a, const Quaternion& b, float t)
+    {
+        double dot = double(a.X)*b.X + double(a.Y)*b.Y + double(a.Z)*b.Z + double(a.W)*b.W;
+        double sign = dot < 0 ? -1 : 1;
+        double theta = std::acos(std::fmin(dot * sign, 1.0));
+        double wa = 1 - t, wb = t;
+
+        if (theta > 1e-9)
+        {
+            wa = std::sin((1 - t) * theta) / std::sin(theta);
+            wb = std::sin(t * theta) / std::sin(theta);
+        }
+
+        wb *= sign;
+        double x = wa*a.X + wb*b.X, y = wa*a.Y + wb*b.Y, z = wa*a.Z + wb*b.Z, w = wa*a.W + wb*b.W;
+        double len = std::sqrt(x*x + y*y + z*z + w*w);
+
+        return Quaternion(float(x / len), float(y / len), float(z / len), float(w / len));
+    }
+}
+
+TEST(SlerpMatchesReference)
+{
+    double maxError = 0;
+
+    for (ui32 i = 0; i < 100000; i++)
+    {
+        Quaternion a = Test::RandomRotation(), b = Test::RandomRotation();
+        float t = Test::Random(0, 1);
+
+        maxError = std::fmax(maxError, Test::RotationAngle(Quaternion::Slerp(a, b, t), ReferenceSlerp(a, b, t)));
+    }
+
+    std::printf("  Slerp: max error %g rad\n", maxError);
+    CHECK(maxError < 1e-5);
+}
+
+TEST(SlerpFastWithinDocumentedBound)
+{
+    double maxError = 0;
+
+    for (ui32 i = 0; i < 100000; i++)
+    {
+        Quaternion a = Test::RandomRotation(), b = Test::RandomRotation();
+        float t = Test::Random(0, 1);
+
+        maxError = std::fmax(maxError, Test::RotationAngle(Quaternion::SlerpFast(a, b, t), ReferenceSlerp(a, b, t)));
+    }
+
+    //Nearly opposite rotations are the worst case
+    Quaternion a = Test::RandomRotation();
+    Quaternion b = Quaternion::Normalize(Quaternion(-a.X, -a.Y, -a.Z + 0.001f, a.W + 0.001f));
+    for (float t = 0; t <= 1; t += 0.01f)
+    {
+        maxError = std::fmax(maxError, Test::RotationAngle(Quaternion::SlerpFast(a, b, t), ReferenceSlerp(a, b, t)));
+    }
+
+    std::printf("  SlerpFast: max error %g rad\n", maxError);
+    CHECK(maxError < 0.001);
+}
+
+namespace
+{
+    //The largest rotation error over many random unit quaternions
+    template <typename P>
+    double MaxPackingError(double* maxLengthError)
+    {
+        double maxError = 0;
+        *maxLengthError = 0;
+
+        for (ui32 i = 0; i < 100000; i++)
+        {
+            Quaternion q = Test::RandomRotation();
+            Quaternion u = P::Pack(q).Unpack();
+
+            maxError = std::fmax(maxError, Test::RotationAngle(q, u));
+            *maxLengthError = std::fmax(*maxLengthError, std::fabs(std::sqrt(double(Quaternion::Dot(u, u))) - 1));
+        }
+
+        return maxError;
+    }
+}
+
+TEST(PackedQuaternionsWithinDocumentedBounds)
+{
+    double lengthError = 0;
+
+    double error32 = MaxPackingError<PackedQuaternion32>(&lengthError);
+    std::printf("  PackedQuaternion32: max error %g rad\n", error32);
+    CHECK(error32 < 0.005);
+
+    double error48 = MaxPackingError<PackedQuaternion48>(&lengthError);
+    std::printf("  PackedQuaternion48: max error %g rad\n", error48);
+    CHECK(error48 < 0.00015);
+
+    double error64 = MaxPackingError<PackedQuaternion64>(&lengthError);
+    std::printf("  PackedQuaternion64: max error %g rad, max length error %g\n", error64, lengthError);
+    CHECK(error64 < 0.0001);
+    CHECK(lengthError < 0.00005);
+
+    //0 has its own code, so rest poses and rotations about a single axis keep their zero components exactly
+    CHECK(PackedQuaternion32::Pack(Quaternion::Identity).Unpack() == Quaternion::Identity);
+    CHECK(PackedQuaternion48::Pack(Quaternion::Identity).Unpack() == Quaternion::Identity);
+
+    for (const Vector3& axis : { Vector3(1, 0, 0), Vector3(0, 1, 0), Vector3(0, 0, 1) })
+    {
+        for (float angle : { 0.3f, MathHelper::PiOver2, 2.5f })
+        {
+            Quaternion q = Quaternion::CreateFromAxisAngle(axis, angle);
+            Quaternion u[2] = { PackedQuaternion32::Pack(q).Unpack(), PackedQuaternion48::Pack(q).Unpack() };
+
+            for (const Quaternion& v : u)
+            {
+                CHECK(axis.X != 0 || v.X == 0);
+                CHECK(axis.Y != 0 || v.Y == 0);
+                CHECK(axis.Z != 0 || v.Z == 0);
+            }
+        }
+    }
+}
+
+TEST(CreateFromRotationMatrixRoundTrips)
+{
+    double maxError = 0;
+
+    for (ui32 i = 0; i < 100000; i++)
+    {
+        Quaternion q = Test::RandomRotation();
+        maxError = std::fmax(maxError, Test::RotationAngle(q, Quaternion::CreateFromRotationMatrix(Matrix::CreateFromQuaternion(q))));
+    }
+
+    //The trace is negative for rotations near 180 degrees, which take the other branches
+    for (const Vector3& axis : { Vector3(1, 0, 0), Vector3(0, 1, 0), Vector3(0, 0, 1) })
+    {
+        Quaternion q = Quaternion::CreateFromAxisAngle(axis, MathHelper::Pi - 0.001f);
+        maxError = std::fmax(maxError, Test::RotationAngle(q, Quaternion::CreateFromRotationMatrix(Matrix::CreateFromQuaternion(q))));
+    }
+
+    std::printf("  CreateFromRotationMatrix: max error %g rad\n", maxError);
+    CHECK(maxError < 1e-5);
+}
+
+TEST(DualQuaternionCreateFromMatrixRoundTrips)
+{
+    for (ui32 i = 0; i < 1000; i++)
+    {
+        Quaternion rotation = Test::RandomRotation();
+        Vector3 translation(Test::Random(-100, 100), Test::Random(-100, 100), Test::Random(-100, 100));
+        Matrix m = Matrix::CreateFromQuaternion(rotation) * Matrix::CreateTranslation(translation);
+
+        DualQuaternion dq = DualQuaternion::CreateFromMatrix(m);
+        Vector3 p(Test::Random(-10, 10), Test::Random(-10, 10), Test::Random(-10, 10));
+
+        CHECK(Test::RotationAngle(dq.Real, rotation) < 1e-5);
+        CHECK(Vector3::Distance(dq.GetTranslation(), translation) < 1e-3f);
+        CHECK(Vector3::Distance(DualQuaternion::TransformPoint(p, dq), Vector3::Transform(p, m)) < 1e-3f);
+    }
+}
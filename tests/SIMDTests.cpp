@@ -0,0 +1,463 @@
+//Checks that the SIMD code paths give exactly the same results as the scalar code. Each test compares against
+//scalar reference code that sums in the library's documented order, or against the single-element version of a
+//batch function, so it passes in both the SIMD and the YAX_NO_SIMD build only if the two paths agree bit for bit.
+//Determinant, Invert, InvertAffine and TransformSurfaceNormal are documented to differ, and aren't checked here.
+
+#include "Test.h"
+
+using namespace YAX;
+
+namespace
+{
+    Matrix ReferenceMultiply(const Matrix& a, const Matrix& b)
+    {
+        Matrix r = Matrix::Identity;
+        const float* fa = &a.M11;
+        const float* fb = &b.M11;
+        float* fr = &r.M11;
+
+        for (ui32 i = 0; i < 4; i++)
+        {
+            for (ui32 j = 0; j < 4; j++)
+            {
+                fr[4*i + j] = fa[4*i]*fb[j] + fa[4*i + 1]*fb[4 + j] + fa[4*i + 2]*fb[8 + j] + fa[4*i + 3]*fb[12 + j];
+            }
+        }
+
+        return r;
+    }
+}
+
+TEST(MatrixMultiplyMatchesScalar)
+{
+    const ui32 count = 37;
+    std::vector<Matrix> a, b;
+    for (ui32 i = 0; i < count; i++)
+    {
+        a.push_back(Test::RandomMatrix());
+        b.push_back(Test::RandomMatrix());
+    }
+
+    std::vector<Matrix> byOne(count, Matrix::Identity), pairwise(count, Matrix::Identity);
+    Matrix::Multiply(a.data(), b[0], byOne.data(), count);
+    Matrix::Multiply(a.data(), b.data(), pairwise.data(), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        Matrix product = a[i];
+        product *= b[i];
+
+        CHECK(Test::BitEqual(product, ReferenceMultiply(a[i], b[i])));
+        CHECK(Test::BitEqual(a[i] * b[i], ReferenceMultiply(a[i], b[i])));
+        CHECK(Test::BitEqual(byOne[i], ReferenceMultiply(a[i], b[0])));
+        CHECK(Test::BitEqual(pairwise[i], ReferenceMultiply(a[i], b[i])));
+    }
+}
+
+TEST(AffineTransformBatchesMatchSingle)
+{
+    const ui32 count = 17;
+    std::vector<Vector3> source, points(count), normals(count);
+    for (ui32 i = 0; i < count; i++)
+    {
+        source.push_back(Vector3(Test::Random(-100, 100), Test::Random(-100, 100), Test::Random(-100, 100)));
+    }
+
+    Matrix m = Test::RandomMatrix();
+    m.M14 = m.M24 = m.M34 = 0;
+    m.M44 = 1;
+    AffineTransform t = AffineTransform::CreateFromMatrix(m);
+
+    AffineTransform::TransformPoint(source.data(), t, points.data(), count);
+    AffineTransform::TransformNormal(source.data(), t, normals.data(), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(points[i], AffineTransform::TransformPoint(source[i], t)));
+        CHECK(Test::BitEqual(normals[i], AffineTransform::TransformNormal(source[i], t)));
+    }
+}
+
+namespace
+{
+    Vector3 ReferenceTransform(const Vector3& v, const Matrix& m, bool translate)
+    {
+        Vector3 r(v.X*m.M11 + v.Y*m.M21 + v.Z*m.M31,
+                  v.X*m.M12 + v.Y*m.M22 + v.Z*m.M32,
+                  v.X*m.M13 + v.Y*m.M23 + v.Z*m.M33);
+
+        return translate ? Vector3(r.X + m.M41, r.Y + m.M42, r.Z + m.M43) : r;
+    }
+
+    Vector4 ReferenceTransform(const Vector4& v, const Matrix& m)
+    {
+        return Vector4(v.X*m.M11 + v.Y*m.M21 + v.Z*m.M31 + v.W*m.M41,
+                       v.X*m.M12 + v.Y*m.M22 + v.Z*m.M32 + v.W*m.M42,
+                       v.X*m.M13 + v.Y*m.M23 + v.Z*m.M33 + v.W*m.M43,
+                       v.X*m.M14 + v.Y*m.M24 + v.Z*m.M34 + v.W*m.M44);
+    }
+
+    std::vector<Vector3> RandomVector3s(ui32 count)
+    {
+        std::vector<Vector3> v;
+        for (ui32 i = 0; i < count; i++)
+        {
+            v.push_back(Vector3(Test::Random(-100, 100), Test::Random(-100, 100), Test::Random(-100, 100)));
+        }
+
+        return v;
+    }
+}
+
+TEST(Vector3TransformMatchesScalar)
+{
+    //Odd counts leave a tail after the wide kernels
+    for (ui32 count : { 1u, 7u, 29u, 5000u })
+    {
+        std::vector<Vector3> source = RandomVector3s(count);
+        std::vector<Vector3> points(count), normals(count);
+        Matrix m = Test::RandomMatrix();
+
+        Vector3::Transform(source.data(), sizeof(Vector3), m, points.data(), sizeof(Vector3), count);
+        Vector3::TransformNormal(source.data(), sizeof(Vector3), m, normals.data(), sizeof(Vector3), count);
+
+        for (ui32 i = 0; i < count; i++)
+        {
+            CHECK(Test::BitEqual(points[i], ReferenceTransform(source[i], m, true)));
+            CHECK(Test::BitEqual(normals[i], ReferenceTransform(source[i], m, false)));
+            CHECK(Test::BitEqual(Vector3::Transform(source[i], m), points[i]));
+        }
+    }
+
+    //Strided, e.g. the positions of interleaved vertices
+    struct Vertex
+    {
+        Vector3 Position;
+        float U, V;
+    };
+
+    std::vector<Vertex> vertices(19);
+    for (Vertex& v : vertices)
+    {
+        v.Position = Vector3(Test::Random(-1, 1), Test::Random(-1, 1), Test::Random(-1, 1));
+    }
+
+    Matrix m = Test::RandomMatrix();
+    std::vector<Vector3> strided(vertices.size());
+    Vector3::Transform(&vertices[0].Position, sizeof(Vertex), m, strided.data(), sizeof(Vector3), static_cast<ui32>(vertices.size()));
+
+    for (ui32 i = 0; i < vertices.size(); i++)
+    {
+        CHECK(Test::BitEqual(strided[i], ReferenceTransform(vertices[i].Position, m, true)));
+    }
+}
+
+TEST(Vector4TransformMatchesScalar)
+{
+    const ui32 count = 29;
+    std::vector<Vector4> source, dest(count);
+    for (ui32 i = 0; i < count; i++)
+    {
+        source.push_back(Vector4(Test::Random(-10, 10), Test::Random(-10, 10), Test::Random(-10, 10), Test::Random(-10, 10)));
+    }
+
+    Matrix m = Test::RandomMatrix();
+    Vector4::Transform(source.data(), sizeof(Vector4), m, dest.data(), sizeof(Vector4), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(dest[i], ReferenceTransform(source[i], m)));
+        CHECK(Test::BitEqual(Vector4::Transform(source[i], m), dest[i]));
+    }
+}
+
+TEST(SoAMatchesScalar)
+{
+    const ui32 count = 21;
+    std::vector<Vector3> source = RandomVector3s(count), other = RandomVector3s(count), result(count);
+    Matrix m = Test::RandomMatrix();
+
+    Vector3SoA soa(source.data(), count), soaOther(other.data(), count), soaResult;
+
+    Vector3SoA::Transform(soa, m, soaResult);
+    soaResult.CopyTo(result.data());
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(result[i], ReferenceTransform(source[i], m, true)));
+    }
+
+    Vector3SoA::TransformNormal(soa, m, soaResult);
+    soaResult.CopyTo(result.data());
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(result[i], ReferenceTransform(source[i], m, false)));
+    }
+
+    Vector3SoA::Lerp(soa, soaOther, 0.3f, soaResult);
+    soaResult.CopyTo(result.data());
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(result[i], Vector3(MathHelper::Lerp(source[i].X, other[i].X, 0.3f),
+                                                MathHelper::Lerp(source[i].Y, other[i].Y, 0.3f),
+                                                MathHelper::Lerp(source[i].Z, other[i].Z, 0.3f))));
+    }
+
+    std::vector<Vector4> source4, result4(count);
+    for (ui32 i = 0; i < count; i++)
+    {
+        source4.push_back(Vector4(source[i], Test::Random(-1, 1)));
+    }
+
+    Vector4SoA soa4(source4.data(), count), soaResult4;
+    Vector4SoA::Transform(soa4, m, soaResult4);
+    soaResult4.CopyTo(result4.data());
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(result4[i], ReferenceTransform(source4[i], m)));
+    }
+}
+
+TEST(ProjectMatchesSingle)
+{
+    //Not a multiple of 4, so the scalar tail runs too
+    const ui32 count = 203;
+    //A camera at z = 10 looking down -z
+    Matrix viewProjection = Matrix::CreateTranslation(0, 0, -10) * Matrix::CreatePerspectiveFieldOfView(MathHelper::PiOver4, 1.5f, 1, 50);
+
+    //Spread across the frustum and beyond every plane, including behind the camera at z > 10
+    std::vector<Vector4> source;
+    for (ui32 i = 0; i < count; i++)
+    {
+        source.push_back(Vector4(Test::Random(-40, 40), Test::Random(-40, 40), Test::Random(-60, 30), 1));
+    }
+
+    std::vector<Vector3> dest(count, Vector3(0, 0, 0)), withoutCodes(count, Vector3(0, 0, 0));
+    std::vector<ui8> outcodes(count, 0xFF);
+
+    Vector4::Project(source.data(), viewProjection, 10, 20, 800, 600, 0, 1, dest.data(), outcodes.data(), count);
+    Vector4::Project(source.data(), viewProjection, 10, 20, 800, 600, 0, 1, withoutCodes.data(), nullptr, count);
+
+    ui8 seen = 0;
+    bool behind = false;
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        Vector3 single(0, 0, 0);
+        ui8 code = 0xFF;
+        Vector4::Project(&source[i], viewProjection, 10, 20, 800, 600, 0, 1, &single, &code, 1);
+
+        CHECK(Test::BitEqual(dest[i], single));
+        CHECK(Test::BitEqual(withoutCodes[i], single));
+        CHECK(outcodes[i] == code);
+
+        seen |= code;
+        behind = behind || Vector4::Transform(source[i], viewProjection).W <= 0;
+    }
+
+    CHECK(seen == (Outcode::Left | Outcode::Right | Outcode::Bottom | Outcode::Top | Outcode::Near | Outcode::Far));
+    CHECK(behind);
+}
+
+TEST(Matrix2DBatchMatchesSingle)
+{
+    const ui32 count = 17;
+    std::vector<Vector2> source, points(count, Vector2(0, 0));
+    for (ui32 i = 0; i < count; i++)
+    {
+        source.push_back(Vector2(Test::Random(-10, 10), Test::Random(-10, 10)));
+    }
+
+    Matrix2D t(Test::Random(-2, 2), Test::Random(-2, 2), Test::Random(-2, 2), Test::Random(-2, 2), Test::Random(-50, 50), Test::Random(-50, 50));
+    Matrix2D::TransformPoint(source.data(), t, points.data(), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(points[i], Matrix2D::TransformPoint(source[i], t)));
+    }
+}
+
+namespace
+{
+    std::vector<Quaternion> RandomRotations(ui32 count)
+    {
+        std::vector<Quaternion> q;
+        for (ui32 i = 0; i < count; i++)
+        {
+            q.push_back(Test::RandomRotation());
+        }
+
+        return q;
+    }
+}
+
+TEST(SlerpBatchesMatchSingle)
+{
+    const ui32 count = 23;
+    std::vector<Quaternion> from = RandomRotations(count), to = RandomRotations(count);
+    std::vector<float> t;
+    for (ui32 i = 0; i < count; i++)
+    {
+        t.push_back(Test::Random(0, 1));
+    }
+
+    std::vector<Quaternion> slerp(count, Quaternion::Identity), slerpFast(count, Quaternion::Identity);
+    Quaternion::Slerp(from.data(), to.data(), t.data(), slerp.data(), count);
+    Quaternion::SlerpFast(from.data(), to.data(), t.data(), slerpFast.data(), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(slerp[i], Quaternion::Slerp(from[i], to[i], t[i])));
+        CHECK(Test::BitEqual(slerpFast[i], Quaternion::SlerpFast(from[i], to[i], t[i])));
+    }
+}
+
+namespace
+{
+    Quaternion ReferenceMultiply(const Quaternion& a, const Quaternion& b)
+    {
+        return Quaternion(a.W*b.X + a.X*b.W + a.Y*b.Z - a.Z*b.Y,
+                          a.W*b.Y - a.X*b.Z + a.Y*b.W + a.Z*b.X,
+                          a.W*b.Z + a.X*b.Y - a.Y*b.X + a.Z*b.W,
+                          a.W*b.W - a.X*b.X - a.Y*b.Y - a.Z*b.Z);
+    }
+
+    Quaternion ReferenceDivide(const Quaternion& a, const Quaternion& b)
+    {
+        float len = b.X*b.X + b.Y*b.Y + b.Z*b.Z + b.W*b.W;
+
+        return Quaternion((b.W*a.X - b.X*a.W - b.Y*a.Z + b.Z*a.Y) / len,
+                          (b.W*a.Y + b.X*a.Z - b.Y*a.W - b.Z*a.X) / len,
+                          (b.W*a.Z - b.X*a.Y + b.Y*a.X - b.Z*a.W) / len,
+                          (a.W*b.W + a.X*b.X + a.Y*b.Y + a.Z*b.Z) / len);
+    }
+}
+
+TEST(QuaternionOperatorsMatchScalar)
+{
+    for (ui32 i = 0; i < 200; i++)
+    {
+        Quaternion a(Test::Random(-2, 2), Test::Random(-2, 2), Test::Random(-2, 2), Test::Random(-2, 2));
+        Quaternion b(Test::Random(-2, 2), Test::Random(-2, 2), Test::Random(-2, 2), Test::Random(-2, 2));
+        float f = Test::Random(-3, 3);
+
+        CHECK(Test::BitEqual(a * b, ReferenceMultiply(a, b)));
+        CHECK(Test::BitEqual(a / b, ReferenceDivide(a, b)));
+        CHECK(Test::BitEqual(a + b, Quaternion(a.X + b.X, a.Y + b.Y, a.Z + b.Z, a.W + b.W)));
+        CHECK(Test::BitEqual(a - b, Quaternion(a.X - b.X, a.Y - b.Y, a.Z - b.Z, a.W - b.W)));
+        CHECK(Test::BitEqual(a * f, Quaternion(a.X*f, a.Y*f, a.Z*f, a.W*f)));
+        CHECK(Test::BitEqual(Quaternion::Conjugate(a), Quaternion(-a.X, -a.Y, -a.Z, a.W)));
+        CHECK(Quaternion::Dot(a, b) == a.X*b.X + a.Y*b.Y + a.Z*b.Z + a.W*b.W);
+
+        float len = std::sqrt(a.X*a.X + a.Y*a.Y + a.Z*a.Z + a.W*a.W);
+        CHECK(Test::BitEqual(Quaternion::Normalize(a), Quaternion(a.X / len, a.Y / len, a.Z / len, a.W / len)));
+    }
+}
+
+TEST(CreateFromQuaternionBatchMatchesSingle)
+{
+    const ui32 count = 13;
+    std::vector<Quaternion> rotations = RandomRotations(count);
+    std::vector<Matrix> matrices(count, Matrix::Identity);
+    Matrix::CreateFromQuaternion(rotations.data(), nullptr, nullptr, matrices.data(), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(matrices[i], Matrix::CreateFromQuaternion(rotations[i])));
+    }
+}
+
+TEST(PackedQuaternionBatchesMatchSingle)
+{
+    const ui32 count = 21;
+    std::vector<Quaternion> source = RandomRotations(count);
+    std::vector<Quaternion> unpacked(count, Quaternion::Identity);
+
+    std::vector<PackedQuaternion32> packed32(count);
+    PackedQuaternion32::Pack(source.data(), packed32.data(), count);
+    PackedQuaternion32::Unpack(packed32.data(), unpacked.data(), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(packed32[i], PackedQuaternion32::Pack(source[i])));
+        CHECK(Test::BitEqual(unpacked[i], packed32[i].Unpack()));
+    }
+
+    std::vector<PackedQuaternion48> packed48(count);
+    PackedQuaternion48::Pack(source.data(), packed48.data(), count);
+    PackedQuaternion48::Unpack(packed48.data(), unpacked.data(), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(packed48[i], PackedQuaternion48::Pack(source[i])));
+        CHECK(Test::BitEqual(unpacked[i], packed48[i].Unpack()));
+    }
+
+    std::vector<PackedQuaternion64> packed64(count);
+    PackedQuaternion64::Pack(source.data(), packed64.data(), count);
+    PackedQuaternion64::Unpack(packed64.data(), unpacked.data(), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(packed64[i], PackedQuaternion64::Pack(source[i])));
+        CHECK(Test::BitEqual(unpacked[i], packed64[i].Unpack()));
+    }
+}
+
+TEST(DualQuaternionBlendMatchesScalar)
+{
+    const ui32 paletteSize = 16, count = 50;
+    std::vector<DualQuaternion> palette;
+    for (ui32 i = 0; i < paletteSize; i++)
+    {
+        Vector3 t(Test::Random(-5, 5), Test::Random(-5, 5), Test::Random(-5, 5));
+        palette.push_back(DualQuaternion::CreateFromRotationTranslation(Test::RandomRotation(), t));
+    }
+
+    std::vector<ui16> indices;
+    std::vector<float> weights;
+    for (ui32 i = 0; i < 4 * count; i++)
+    {
+        indices.push_back(static_cast<ui16>(Test::Rng()() % paletteSize));
+        weights.push_back(Test::Random(0, 1));
+    }
+
+    std::vector<DualQuaternion> blended(count, DualQuaternion::Identity);
+    DualQuaternion::Blend(palette.data(), indices.data(), weights.data(), blended.data(), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        const ui16* index = &indices[4 * i];
+        const float* weight = &weights[4 * i];
+        const Quaternion& pivot = palette[index[0]].Real;
+        DualQuaternion expected(pivot * weight[0], palette[index[0]].Dual * weight[0]);
+
+        for (ui32 j = 1; j < 4; j++)
+        {
+            const DualQuaternion& dq = palette[index[j]];
+            float w = Quaternion::Dot(dq.Real, pivot) < 0.0f ? -weight[j] : weight[j];
+            expected.Real += dq.Real * w;
+            expected.Dual += dq.Dual * w;
+        }
+
+        expected.Normalize();
+        CHECK(Test::BitEqual(blended[i], expected));
+    }
+}
+
+TEST(CreateFromRotationMatrixBatchMatchesSingle)
+{
+    const ui32 count = 23;
+    std::vector<Matrix> rotations;
+    for (const Quaternion& q : RandomRotations(count))
+    {
+        rotations.push_back(Matrix::CreateFromQuaternion(q));
+    }
+
+    std::vector<Quaternion> fromMatrix(count, Quaternion::Identity);
+    Quaternion::CreateFromRotationMatrix(rotations.data(), fromMatrix.data(), count);
+
+    for (ui32 i = 0; i < count; i++)
+    {
+        CHECK(Test::BitEqual(fromMatrix[i], Quaternion::CreateFromRotationMatrix(rotations[i])));
+    }
+}
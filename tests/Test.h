@@ -0,0 +1,127 @@
+#ifndef _YAX_TEST_H
+#define _YAX_TEST_H
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "YAX.Math.h"
+
+//A minimal test runner. The tests are built twice, as YAX.Math.Tests (SIMD) and YAX.Math.Tests.Scalar (YAX_NO_SIMD),
+//and the bit-identity tests compare against scalar reference code, so passing both builds means the SIMD and
+//scalar code paths agree bit for bit.
+namespace Test
+{
+    using TestFunction = void (*)();
+
+    struct Case
+    {
+        const char* Name;
+        TestFunction Run;
+    };
+
+    inline std::vector<Case>& Cases()
+    {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    inline int& Failures()
+    {
+        static int failures = 0;
+        return failures;
+    }
+
+    struct Register
+    {
+        Register(const char* name, TestFunction run)
+        {
+            Cases().push_back({ name, run });
+        }
+    };
+
+    inline void Fail(const char* file, int line, const char* expression)
+    {
+        std::printf("  %s(%d): CHECK(%s) failed\n", file, line, expression);
+        Failures()++;
+    }
+
+    //Compares the object representations, so -0 differs from 0 and NaNs can be equal
+    template <typename T>
+    bool BitEqual(const T& a, const T& b)
+    {
+        return std::memcmp(&a, &b, sizeof(T)) == 0;
+    }
+
+    template <typename T>
+    bool BitEqual(const T* a, const T* b, YAX::ui32 count)
+    {
+        return std::memcmp(a, b, sizeof(T) * count) == 0;
+    }
+
+    //A fixed seed, so failures can be reproduced
+    inline std::mt19937& Rng()
+    {
+        static std::mt19937 rng(12345);
+        return rng;
+    }
+
+    inline float Random(float min, float max)
+    {
+        return std::uniform_real_distribution<float>(min, max)(Rng());
+    }
+
+    inline YAX::Matrix RandomMatrix()
+    {
+        YAX::Matrix m = YAX::Matrix::Identity;
+        float* f = &m.M11;
+
+        for (YAX::ui32 i = 0; i < 16; i++)
+        {
+            f[i] = Random(-10.0f, 10.0f);
+        }
+
+        return m;
+    }
+
+    inline YAX::Quaternion RandomRotation()
+    {
+        return YAX::Quaternion::Normalize(YAX::Quaternion(Random(-1, 1), Random(-1, 1), Random(-1, 1), Random(-1, 1)));
+    }
+
+    //The largest absolute difference between the elements of two matrices
+    inline float MaxDifference(const YAX::Matrix& a, const YAX::Matrix& b)
+    {
+        const float* fa = &a.M11;
+        const float* fb = &b.M11;
+        float max = 0;
+
+        for (YAX::ui32 i = 0; i < 16; i++)
+        {
+            max = std::fmax(max, std::fabs(fa[i] - fb[i]));
+        }
+
+        return max;
+    }
+
+    //The angle in radians of the rotation between two unit quaternions, accurate even when it is tiny
+    inline double RotationAngle(const YAX::Quaternion& a, const YAX::Quaternion& b)
+    {
+        double sign = double(a.X)*b.X + double(a.Y)*b.Y + double(a.Z)*b.Z + double(a.W)*b.W < 0 ? -1 : 1;
+        double dx = a.X - sign*b.X, dy = a.Y - sign*b.Y, dz = a.Z - sign*b.Z, dw = a.W - sign*b.W;
+        double sx = a.X + sign*b.X, sy = a.Y + sign*b.Y, sz = a.Z + sign*b.Z, sw = a.W + sign*b.W;
+
+        //The angle between the unit vectors is 2*atan2(|a - b|, |a + b|), and the rotation angle is twice that
+        return 4 * std::atan2(std::sqrt(dx*dx + dy*dy + dz*dz + dw*dw), std::sqrt(sx*sx + sy*sy + sz*sz + sw*sw));
+    }
+}
+
+#define TEST(name) \
+    static void name(); \
+    static Test::Register name##Registration(#name, name); \
+    static void name()
+
+#define CHECK(expression) ((expression) ? (void)0 : Test::Fail(__FILE__, __LINE__, #expression))
+
+#endif
@@ -0,0 +1,152 @@
+//Checks the Vector3 batch functions that do more than transform each element independently
+
+#include <algorithm>
+#include <stdexcept>
+#include "Test.h"
+
+using namespace YAX;
+
+namespace
+{
+    //Streams source through TransformStream in chunks of chunkSize, collecting the output in order
+    std::vector<Vector3> Stream(const std::vector<Vector3>& source, const Matrix& m, ui32 chunkSize, ExecutionPolicy policy, ui64* total)
+    {
+        size_t read = 0;
+        std::vector<Vector3> output;
+
+        *total = Vector3::TransformStream([&](Vector3* buffer, ui32 capacity)
+        {
+            ui32 n = static_cast<ui32>(std::min<size_t>(capacity, source.size() - read));
+            std::copy(source.begin() + read, source.begin() + read + n, buffer);
+            read += n;
+            return n;
+        }, m, [&](const Vector3* buffer, ui32 count)
+        {
+            output.insert(output.end(), buffer, buffer + count);
+        }, chunkSize, policy);
+
+        return output;
+    }
+}
+
+TEST(TransformStreamKeepsOrder)
+{
+    //1001 is not a multiple of 64, so the final chunk is short
+    std::vector<Vector3> source;
+    for (ui32 i = 0; i < 1001; i++)
+    {
+        source.push_back(Vector3(Test::Random(-100, 100), Test::Random(-100, 100), Test::Random(-100, 100)));
+    }
+
+    Matrix m = Test::RandomMatrix();
+    std::vector<Vector3> expected(source.size());
+    Vector3::Transform(source.data(), sizeof(Vector3), m, expected.data(), sizeof(Vector3), static_cast<ui32>(source.size()));
+
+    for (ExecutionPolicy policy : { ExecutionPolicy::Sequential, ExecutionPolicy::Parallel })
+    {
+        ui64 total = 0;
+        std::vector<Vector3> output = Stream(source, m, 64, policy, &total);
+
+        CHECK(total == source.size());
+        CHECK(output.size() == source.size());
+        CHECK(output.size() == source.size() && Test::BitEqual(output.data(), expected.data(), static_cast<ui32>(output.size())));
+    }
+}
+
+TEST(TransformStreamOfNothing)
+{
+    ui64 total = 1;
+    std::vector<Vector3> output = Stream(std::vector<Vector3>(), Matrix::Identity, 64, ExecutionPolicy::Sequential, &total);
+
+    CHECK(total == 0);
+    CHECK(output.empty());
+}
+
+TEST(TransformStreamRethrows)
+{
+    auto reader = [](Vector3* buffer, ui32 capacity)
+    {
+        for (ui32 i = 0; i < capacity; i++)
+        {
+            buffer[i] = Vector3(static_cast<float>(i), 0, 0);
+        }
+
+        return capacity;
+    };
+
+    //A reader that fails on its fifth chunk, while earlier chunks are still being transformed and written
+    ui32 reads = 0, writes = 0;
+    bool caught = false;
+
+    try
+    {
+        Vector3::TransformStream([&](Vector3* buffer, ui32 capacity)
+        {
+            if (++reads == 5)
+            {
+                throw std::runtime_error("read failed");
+            }
+
+            return reader(buffer, capacity);
+        }, Matrix::Identity, [&](const Vector3*, ui32) { writes++; }, 32, ExecutionPolicy::Sequential);
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    CHECK(caught);
+    CHECK(writes <= 4);
+
+    //A writer that fails on its third chunk of an endless stream
+    reads = 0;
+    writes = 0;
+    caught = false;
+
+    try
+    {
+        Vector3::TransformStream([&](Vector3* buffer, ui32 capacity)
+        {
+            reads++;
+            return reader(buffer, capacity);
+        }, Matrix::Identity, [&](const Vector3*, ui32)
+        {
+            if (++writes == 3)
+            {
+                throw std::runtime_error("write failed");
+            }
+        }, 32, ExecutionPolicy::Sequential);
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    CHECK(caught);
+    CHECK(writes == 3);
+}
+
+TEST(TransformSurfaceNormalHandlesTinyScales)
+{
+    Matrix rotation = Matrix::CreateFromYawPitchRoll(0.3f, 1.1f, -0.7f);
+    Vector3 normals[] = { Vector3(0, 1, 0), Vector3(0.6f, 0, 0.8f), Vector3(0, 0, 0) };
+    Vector3 expected[3], result[3];
+
+    Vector3::TransformSurfaceNormal(normals, sizeof(Vector3), Matrix::CreateScale(1, 2, 1) * rotation, expected, sizeof(Vector3), 3);
+
+    for (float scale : { 1e-10f, 1e-20f, 1e-30f })
+    {
+        Matrix m = Matrix::CreateScale(scale, 2 * scale, scale) * rotation;
+        Vector3::TransformSurfaceNormal(normals, sizeof(Vector3), m, result, sizeof(Vector3), 3);
+
+        //A uniform scale doesn't change the normals, however small it is
+        for (ui32 i = 0; i < 2; i++)
+        {
+            CHECK(std::isfinite(result[i].X) && std::isfinite(result[i].Y) && std::isfinite(result[i].Z));
+            CHECK(std::fabs(result[i].Length() - 1) < 1e-5f);
+            CHECK(Vector3::Distance(result[i], expected[i]) < 1e-5f);
+        }
+
+        CHECK(Test::BitEqual(result[2], Vector3(0, 0, 0)));
+    }
+}